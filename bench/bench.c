@@ -0,0 +1,12 @@
+#include "Arduino.h"
+#include "bench.h"
+
+volatile __xdata uint32_t bench_result;
+
+void bench_start(void)
+{
+}
+
+void bench_stop(void)
+{
+}
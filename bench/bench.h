@@ -0,0 +1,22 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+// Measurement markers for the s51 benchmarks (bench/bench.py)
+//
+// bench.py puts a breakpoint on each marker and reads the simulator's
+// clock counters there. The markers live in their own file so SDCC can't
+// inline them, and volatile results keep the measured calls alive.
+
+/**
+ * @brief Start of the measured section
+ */
+void bench_start(void);
+
+/**
+ * @brief End of the measured section
+ */
+void bench_stop(void);
+
+extern volatile __xdata uint32_t bench_result;
+
+#endif // BENCH_H
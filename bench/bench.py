@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+"""Cycle and size benchmarks for the core APIs.
+
+Builds every probe in bench/probes with the compile and link flags from
+platform.txt/boards.txt, runs it in the s51 simulator bundled with SDCC
+and prints one CSV row per probe and clock speed:
+
+    probe,f_cpu,clks,isr_clks,isr_clks_per_event,code,code_delta,iram,xram
+
+clks is the simulated time between bench_start() and bench_stop(), minus
+the same measurement of the empty probe. isr_clks is the part of it
+spent in interrupt handlers. code/iram/xram come from the linker's .mem
+file; code_delta is the code size above the empty probe.
+
+s51 models a classic 12T 8051, not the 1T STC8 core, so the clock counts
+are only meant for comparing commits against each other.
+
+Probe options are comment lines at the top of the probe:
+
+    // bench-events: N      ISR entries expected during the measurement
+    // bench-uart: text     UART input fed to the simulator (\\n escapes)
+    // bench-irq: int0      Raise INT0 right after bench_start()
+    // bench-i2c: N         Scripted I2C slave: complete N bus commands
+    // bench-lib: NAME      Link libraries/NAME/src (as an archive)
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+BENCH = os.path.join(ROOT, 'bench')
+BOARD = 'stc8g1k08a'
+
+# XFR addresses used by the scripted I2C slave
+I2CMSST = 0xFE82
+I2CRXD = 0xFE87
+I2C_MSIF = 0x40
+I2C_SLAVE_DATA = 0x5A
+
+# TCON.1 (IE0) bit address
+TCON_IE0 = 0x89
+
+
+def read_properties(path):
+    props = {}
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if line and not line.startswith('#') and '=' in line:
+                key, value = line.split('=', 1)
+                props[key] = value
+    return props
+
+
+def expand(value, props):
+    for _ in range(10):
+        expanded = re.sub(r'\{([^}]+)\}', lambda m: props.get(m.group(1), m.group(0)), value)
+        if expanded == value:
+            break
+        value = expanded
+    return value
+
+
+def board_config():
+    platform = read_properties(os.path.join(ROOT, 'platform.txt'))
+    boards = read_properties(os.path.join(ROOT, 'boards.txt'))
+    props = dict(platform)
+    prefix = BOARD + '.'
+    for key, value in boards.items():
+        if key.startswith(prefix) and '.menu.' not in key:
+            props[key[len(prefix):]] = value
+
+    clocks = [value for key, value in boards.items()
+              if key.startswith(prefix + 'menu.clock.') and key.endswith('.build.f_cpu')]
+    return props, clocks
+
+
+def probe_options(path):
+    options = {'events': 0, 'uart': '', 'irq': '', 'i2c': 0, 'lib': ''}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r'//\s*bench-(\w+):\s*(.*)', line)
+            if not m:
+                continue
+            key, value = m.group(1), m.group(2).strip()
+            if key in ('events', 'i2c'):
+                options[key] = int(value)
+            elif key == 'uart':
+                options[key] = value.encode().decode('unicode_escape')
+            else:
+                options[key] = value
+    return options
+
+
+def run(cmd, **kwargs):
+    result = subprocess.run(cmd, capture_output=True, text=True, **kwargs)
+    if result.returncode != 0:
+        sys.stderr.write(' '.join(cmd) + '\n' + result.stdout + result.stderr)
+        raise SystemExit(1)
+    return result
+
+
+class Builder:
+    def __init__(self, sdcc_home, props, f_cpu, tick_timer, mem_profile, build_dir):
+        self.sdcc = os.path.join(sdcc_home, 'bin', 'sdcc')
+        self.sdar = os.path.join(sdcc_home, 'bin', 'sdar')
+        self.libpath = os.path.join(sdcc_home, 'share', 'sdcc', 'lib', 'small')
+        self.build_dir = build_dir
+
+        self.c_flags = expand(props['compiler.c.flags'], props).split()
+        self.c_flags = [flag for flag in self.c_flags if flag != '-MMD']
+        self.c_flags += ['-mmcs51', '-D' + props['build.mcu'], '-DF_CPU=' + f_cpu,
+                         '-DTICK_TIMER=%d' % tick_timer, '-DMEM_PROFILE=%d' % mem_profile,
+                         '-DARDUINO_' + props['build.board'], '-DARDUINO_ARCH_STC8',
+                         '-I' + os.path.join(ROOT, 'cores', 'stc8'),
+                         '-I' + os.path.join(ROOT, 'variants', BOARD),
+                         '-I' + BENCH,
+                         '-I' + os.path.join(sdcc_home, 'share', 'sdcc', 'include')]
+        self.elf_flags = expand(props['compiler.c.elf.flags'], props).split()
+        self.libraries = {}
+
+    def compile(self, src, obj):
+        os.makedirs(os.path.dirname(obj), exist_ok=True)
+        run([self.sdcc] + self.c_flags + [src, '-o', obj])
+
+    def compile_tree(self, tree, out):
+        objects = []
+        for dirpath, _, files in os.walk(tree):
+            for name in sorted(files):
+                if name.endswith('.c'):
+                    src = os.path.join(dirpath, name)
+                    rel = os.path.relpath(src, tree)
+                    obj = os.path.join(out, os.path.splitext(rel)[0] + '.rel')
+                    self.compile(src, obj)
+                    objects.append(obj)
+        return objects
+
+    def build_core(self):
+        core_objects = self.compile_tree(os.path.join(ROOT, 'cores', 'stc8'),
+                                         os.path.join(self.build_dir, 'core'))
+        core_lib = os.path.join(self.build_dir, 'core.lib')
+        if os.path.exists(core_lib):
+            os.remove(core_lib)
+        run([self.sdar, 'rcs', core_lib] + core_objects)
+
+        # Keep the variant layout: the link wrapper only links objects under
+        # drivers/src when something references them
+        self.variant_objects = self.compile_tree(os.path.join(ROOT, 'variants', BOARD),
+                                                 os.path.join(self.build_dir, 'variant'))
+        self.bench_object = os.path.join(self.build_dir, 'bench.rel')
+        self.compile(os.path.join(BENCH, 'bench.c'), self.bench_object)
+        self.core_lib = core_lib
+
+    def build_library(self, name):
+        """Archive of libraries/NAME/src, like dot_a_linkage in the IDE."""
+        if name not in self.libraries:
+            src = os.path.join(ROOT, 'libraries', name, 'src')
+            out = os.path.join(self.build_dir, 'libraries', name)
+            objects = self.compile_tree(src, out)
+            lib = out + '.lib'
+            if os.path.exists(lib):
+                os.remove(lib)
+            run([self.sdar, 'rcs', lib] + objects)
+            self.libraries[name] = lib
+        return self.libraries[name]
+
+    def link(self, probe, library=''):
+        name = os.path.splitext(os.path.basename(probe))[0]
+        out = os.path.join(self.build_dir, name)
+        probe_object = os.path.join(out, name + '.rel')
+        archives = []
+        if library:
+            archives.append(os.path.splitext(self.build_library(library))[0] + '.a')
+            self.c_flags.append('-I' + os.path.join(ROOT, 'libraries', library, 'src'))
+        try:
+            self.compile(probe, probe_object)
+        finally:
+            if library:
+                self.c_flags.pop()
+
+        # sdcc-link.sh takes Arduino style .o/.a names and uses the .rel/.lib
+        objects = [os.path.splitext(o)[0] + '.o'
+                   for o in [probe_object, self.bench_object] + self.variant_objects]
+        ihx = os.path.join(out, name + '.ihx')
+        run([os.path.join(ROOT, 'tools', 'wrapper', 'sdcc-link.sh'), self.sdcc] +
+            self.elf_flags + ['-L' + self.build_dir, '-L' + self.libpath, '-mmcs51'] +
+            objects + archives + [os.path.splitext(self.core_lib)[0] + '.a',
+                       '-lmcs51', '-llibsdcc', '-lliblong', '-lliblonglong', '-llibint',
+                       '-llibfloat', '--out-fmt-ihx', '-o', ihx])
+        return ihx
+
+
+def map_symbol(map_file, symbol):
+    with open(map_file, errors='ignore') as f:
+        for line in f:
+            m = re.search(r'\b([0-9A-Fa-f]{4,8})\s+' + re.escape(symbol) + r'\b', line)
+            if m:
+                return int(m.group(1), 16)
+    return None
+
+
+def mem_sizes(mem_file):
+    code = xram = iram = 0
+    with open(mem_file, errors='ignore') as f:
+        for line in f:
+            fields = line.split()
+            if line.strip().startswith('ROM/EPROM/FLASH'):
+                code = int(fields[3])
+            elif line.strip().startswith('EXTERNAL RAM'):
+                xram = int(fields[4])
+            m = re.search(r'Stack starts at:\s*0x([0-9A-Fa-f]+)', line)
+            if m:
+                iram = int(m.group(1), 16)
+    return code, iram, xram
+
+
+def simulate(s51, ihx, f_cpu, options, timeout):
+    base = os.path.splitext(ihx)[0]
+    start = map_symbol(base + '.map', '_bench_start')
+    stop = map_symbol(base + '.map', '_bench_stop')
+    if start is None or stop is None:
+        raise SystemExit('%s: bench markers not found in map file' % ihx)
+
+    commands = ['break 0x%x' % start, 'break 0x%x' % stop]
+    if options['i2c']:
+        i2c_wait = map_symbol(base + '.map', '_i2c_wait')
+        commands.append('break 0x%x' % i2c_wait)
+        commands.append('set memory xram 0x%x 0x%x' % (I2CRXD, I2C_SLAVE_DATA))
+    commands += ['run', 'state']
+    if options['irq'] == 'int0':
+        commands.append('set bit 0x%x 1' % TCON_IE0)
+    for _ in range(options['i2c']):
+        # Stopped at i2c_wait(): finish the bus command with an ACK
+        commands += ['run', 'set memory xram 0x%x 0x%x' % (I2CMSST, I2C_MSIF)]
+    commands += ['run', 'state', 'quit']
+
+    with tempfile.NamedTemporaryFile('w', suffix='.uart', delete=False) as uart:
+        uart.write(options['uart'])
+    try:
+        result = subprocess.run([s51, '-t', '8052', '-X', f_cpu.rstrip('L'),
+                                 '-S', 'in=%s,out=%s' % (uart.name, os.devnull), ihx],
+                                input='\n'.join(commands) + '\n',
+                                capture_output=True, text=True, timeout=timeout)
+    finally:
+        os.remove(uart.name)
+
+    total = [int(n) for n in re.findall(r'Total time since last reset=.*?\((\d+) clks\)', result.stdout)]
+    isr = [int(n) for n in re.findall(r'Time in isr\s*=.*?\((\d+) clks\)', result.stdout)]
+    if len(total) < 2:
+        raise SystemExit('%s: simulation did not reach both markers\n%s' % (ihx, result.stdout))
+    isr_clks = isr[1] - isr[0] if len(isr) >= 2 else 0
+    return total[1] - total[0], isr_clks
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--sdcc-home', default=os.environ.get('SDCC_HOME'),
+                        help='SDCC install prefix (default: from the sdcc in PATH)')
+    parser.add_argument('--f-cpu', action='append', help='Clock to run (default: every board menu clock)')
+    parser.add_argument('--probe', action='append', help='Probe name to run (default: all)')
+    parser.add_argument('--tick-timer', type=int, default=0)
+    parser.add_argument('--mem-profile', type=int, default=0)
+    parser.add_argument('--timeout', type=int, default=60, help='Seconds per simulation')
+    parser.add_argument('-o', '--output', help='CSV file (default: stdout)')
+    args = parser.parse_args()
+
+    sdcc_home = args.sdcc_home
+    if not sdcc_home:
+        sdcc = shutil.which('sdcc')
+        if not sdcc:
+            raise SystemExit('sdcc not found; set SDCC_HOME or --sdcc-home')
+        sdcc_home = os.path.dirname(os.path.dirname(os.path.realpath(sdcc)))
+    s51 = os.path.join(sdcc_home, 'bin', 's51')
+    if not os.path.exists(s51):
+        s51 = shutil.which('s51') or s51
+
+    props, clocks = board_config()
+    clocks = args.f_cpu or clocks
+
+    probes_dir = os.path.join(BENCH, 'probes')
+    probes = sorted(os.path.join(probes_dir, p) for p in os.listdir(probes_dir) if p.endswith('.c'))
+    if args.probe:
+        probes = [p for p in probes if os.path.splitext(os.path.basename(p))[0] in args.probe]
+    empty = os.path.join(probes_dir, 'empty.c')
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    out.write('probe,f_cpu,clks,isr_clks,isr_clks_per_event,code,code_delta,iram,xram\n')
+
+    for f_cpu in clocks:
+        build_dir = os.path.join(BENCH, 'build', f_cpu)
+        builder = Builder(sdcc_home, props, f_cpu, args.tick_timer, args.mem_profile, build_dir)
+        builder.build_core()
+
+        empty_ihx = builder.link(empty)
+        empty_clks, _ = simulate(s51, empty_ihx, f_cpu, probe_options(empty), args.timeout)
+        empty_code, _, _ = mem_sizes(os.path.splitext(empty_ihx)[0] + '.mem')
+
+        for probe in probes:
+            options = probe_options(probe)
+            ihx = builder.link(probe, options['lib'])
+            clks, isr_clks = simulate(s51, ihx, f_cpu, options, args.timeout)
+            code, iram, xram = mem_sizes(os.path.splitext(ihx)[0] + '.mem')
+            per_event = isr_clks // options['events'] if options['events'] else ''
+            out.write('%s,%s,%d,%d,%s,%d,%d,%d,%d\n' % (
+                os.path.splitext(os.path.basename(probe))[0], f_cpu.rstrip('L'),
+                clks - empty_clks, isr_clks, per_event, code, code - empty_code, iram, xram))
+            out.flush()
+
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
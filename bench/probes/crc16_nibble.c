@@ -0,0 +1,23 @@
+// bench: crc16Update() over 32 bytes, 16-entry table
+#include "Arduino.h"
+#include "bench.h"
+
+__xdata uint8_t data[32];
+volatile uint16_t result;
+
+void setup(void)
+{
+    uint16_t crc = CRC16_INIT;
+    uint8_t i;
+
+    bench_start();
+    for (i = 0; i < sizeof(data); i++) {
+        crc = crc16Update(crc, data[i]);
+    }
+    result = crc;
+    bench_stop();
+}
+
+void loop(void)
+{
+}
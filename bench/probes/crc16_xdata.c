@@ -0,0 +1,17 @@
+// bench: crc16Xdata() over 32 bytes, 256-entry table
+#include "Arduino.h"
+#include "bench.h"
+
+__xdata uint8_t data[32];
+volatile uint16_t result;
+
+void setup(void)
+{
+    bench_start();
+    result = crc16Xdata(CRC16_INIT, data, sizeof(data));
+    bench_stop();
+}
+
+void loop(void)
+{
+}
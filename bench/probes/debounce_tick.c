@@ -0,0 +1,28 @@
+// bench: Button debounce, 8 samples of six pins with one change posted
+#include "Arduino.h"
+#include "bench.h"
+
+static void on_button(const Event_t *event)
+{
+    (void)event;
+}
+
+void setup(void)
+{
+    uint8_t i;
+
+    debounceBegin(0x3F, DEBOUNCE_RATE_DEFAULT_HZ);
+    timerStop(TIMER_SPARE);  // The probe drives the samples itself
+    onEvent(EVENT_SOURCE_BUTTON, on_button);
+    P3 &= ~0x04;             // P3_2 pressed
+
+    bench_start();
+    for (i = 0; i < 8; i++) {
+        debounceTick();
+    }
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,17 @@
+// bench: digitalWrite() high then low on a constant pin
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    pinMode(P3_3, OUTPUT);
+
+    bench_start();
+    digitalWrite(P3_3, HIGH);
+    digitalWrite(P3_3, LOW);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,13 @@
+// bench: Calibration, subtracted from every other probe
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    bench_start();
+    bench_stop();
+}
+
+void loop(void)
+{
+}
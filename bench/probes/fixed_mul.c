@@ -0,0 +1,20 @@
+// bench: q16Mul() of two Q16.16 values, compare with float_mul
+// bench-lib: 3.FixedPoint
+#include "Arduino.h"
+#include "fixed_point.h"
+#include "bench.h"
+
+volatile q16_16_t a = Q16_16(12.345);
+volatile q16_16_t b = Q16_16(-6.789);
+volatile q16_16_t result;
+
+void setup(void)
+{
+    bench_start();
+    result = q16Mul(a, b);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
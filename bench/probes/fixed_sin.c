@@ -0,0 +1,19 @@
+// bench: fixSin() table lookup, compare with float_sin
+// bench-lib: 3.FixedPoint
+#include "Arduino.h"
+#include "fixed_point.h"
+#include "bench.h"
+
+volatile fixangle_t angle = FIXANGLE_DEG(37);
+volatile q1_15_t result;
+
+void setup(void)
+{
+    bench_start();
+    result = fixSin(angle);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,19 @@
+// bench: q16Sqrt(), compare with float_sqrt
+// bench-lib: 3.FixedPoint
+#include "Arduino.h"
+#include "fixed_point.h"
+#include "bench.h"
+
+volatile q16_16_t value = Q16_16(1234.5);
+volatile q16_16_t result;
+
+void setup(void)
+{
+    bench_start();
+    result = q16Sqrt(value);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
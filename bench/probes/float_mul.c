@@ -0,0 +1,18 @@
+// bench: float multiply with SDCC's libfloat, compare with fixed_mul
+#include "Arduino.h"
+#include "bench.h"
+
+volatile float a = 12.345;
+volatile float b = -6.789;
+volatile float result;
+
+void setup(void)
+{
+    bench_start();
+    result = a * b;
+    bench_stop();
+}
+
+void loop(void)
+{
+}
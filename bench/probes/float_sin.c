@@ -0,0 +1,18 @@
+// bench: sinf() from SDCC's libfloat, compare with fixed_sin
+#include <math.h>
+#include "Arduino.h"
+#include "bench.h"
+
+volatile float angle = 0.6458;  // 37 degrees
+volatile float result;
+
+void setup(void)
+{
+    bench_start();
+    result = sinf(angle);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,18 @@
+// bench: sqrtf() from SDCC's libfloat, compare with fixed_sqrt
+#include <math.h>
+#include "Arduino.h"
+#include "bench.h"
+
+volatile float value = 1234.5;
+volatile float result;
+
+void setup(void)
+{
+    bench_start();
+    result = sqrtf(value);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
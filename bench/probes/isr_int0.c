@@ -0,0 +1,26 @@
+// bench: INT0 entry through attachInterrupt() to an empty handler
+// bench-irq: int0
+// bench-events: 1
+#include "Arduino.h"
+#include "bench.h"
+
+static void on_int0(void)
+{
+}
+
+void setup(void)
+{
+    attachInterrupt(INT0_INTERRUPT, on_int0, FALLING);
+
+    bench_start();
+    // bench.py raises IE0 here; give the interrupt a few cycles to land
+    NOP();
+    NOP();
+    NOP();
+    NOP();
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,21 @@
+// bench: Tick timer interrupt, 5 ticks
+// bench-events: 5
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    uint32_t start = millis();
+
+    // Align to a tick so exactly 5 interrupts fall in the window
+    while (millis() == start);
+    start = millis();
+
+    bench_start();
+    while (millis() - start < 5);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
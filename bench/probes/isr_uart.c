@@ -0,0 +1,18 @@
+// bench: UART receive interrupt for 8 scripted bytes
+// bench-uart: 12345678
+// bench-events: 8
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    serialBegin(115200);
+
+    bench_start();
+    while (serialAvailable() < 8);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,14 @@
+// bench: One micros() call
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    bench_start();
+    bench_result = micros();
+    bench_stop();
+}
+
+void loop(void)
+{
+}
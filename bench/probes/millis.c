@@ -0,0 +1,14 @@
+// bench: One millis() call
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    bench_start();
+    bench_result = millis();
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,23 @@
+// bench: SDCC's printf_small() of the serial_printf line, for comparison
+#include <stdio.h>
+#include "Arduino.h"
+#include "bench.h"
+
+int putchar(int c)
+{
+    serialWrite((uint8_t)c);
+    return c;
+}
+
+void setup(void)
+{
+    serialBegin(115200);
+
+    bench_start();
+    printf_small("n=%d %ld x=%x s=%s\r\n", -1234, -1234567890L, 0xBEEF, "ok");
+    bench_stop();
+}
+
+void loop(void)
+{
+}
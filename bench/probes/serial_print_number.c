@@ -0,0 +1,16 @@
+// bench: serialPrintNumber() of a 10-digit negative value
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    serialBegin(115200);
+
+    bench_start();
+    serialPrintNumber(-1234567890L);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,16 @@
+// bench: serialPrintf() of a line with int, long, hex and string fields
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    serialBegin(115200);
+
+    bench_start();
+    serialPrintf("n=%d %ld x=%x s=%s\r\n", -1234, -1234567890L, 0xBEEF, "ok");
+    bench_stop();
+}
+
+void loop(void)
+{
+}
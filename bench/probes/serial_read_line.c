@@ -0,0 +1,18 @@
+// bench: serialReadLine() on scripted input
+// bench-uart: hello\n
+// bench-events: 6
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    serialBegin(115200);
+
+    bench_start();
+    bench_result = serialReadLine()[0];
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,16 @@
+// bench: serialWrite() of one byte, including the wait for TI
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    serialBegin(115200);
+
+    bench_start();
+    serialWrite('A');
+    bench_stop();
+}
+
+void loop(void)
+{
+}
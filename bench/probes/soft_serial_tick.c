@@ -0,0 +1,27 @@
+// bench: Software UART bit engine, 30 ticks (one byte out and one in)
+#include "Arduino.h"
+#include "bench.h"
+
+// Driver internals (soft_serial_private.h), called here without the timer
+void soft_serial_tick(void);
+void soft_serial_start_bit(void);
+
+void setup(void)
+{
+    uint8_t i;
+
+    softSerialBegin(P3_2, P3_3, 9600);
+    timerStop(TIMER_SPARE);  // The probe drives the ticks itself
+    softSerialWrite('U');
+    soft_serial_start_bit();
+
+    bench_start();
+    for (i = 0; i < 30; i++) {
+        soft_serial_tick();
+    }
+    bench_stop();
+}
+
+void loop(void)
+{
+}
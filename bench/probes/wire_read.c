@@ -0,0 +1,20 @@
+// bench: Wire read of two bytes from a scripted slave
+// bench-i2c: 8
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    wireBegin();
+
+    // START, address, ACK, 2 x (receive, ACK/NAK) and STOP
+    bench_start();
+    wireRequestFrom(0x50, 2, true);
+    bench_result = wireRead();
+    bench_result += wireRead();
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,21 @@
+// bench: Wire write of two bytes to a scripted slave
+// bench-i2c: 6
+#include "Arduino.h"
+#include "bench.h"
+
+void setup(void)
+{
+    wireBegin();
+
+    // START, address, 2 data bytes and STOP, each followed by i2c_wait()
+    bench_start();
+    wireBeginTransmission(0x50);
+    wireWrite(0x00);
+    wireWrite(0x10);
+    bench_result = wireEndTransmission(true);
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -0,0 +1,23 @@
+// bench: ws2812Show() of 8 LEDs on P3.3 with brightness and gamma
+// bench-lib: 4.WS2812
+#include "Arduino.h"
+#include "ws2812.h"
+#include "bench.h"
+
+__xdata uint8_t leds[WS2812_BYTES(8)];
+
+void setup(void)
+{
+    ws2812Begin(P3_3, leds, 8);
+    ws2812Fill(255, 128, 1);
+    ws2812SetBrightness(100);
+    delay_us(WS2812_LATCH_US);  // So the latch wait is not measured
+
+    bench_start();
+    ws2812Show();
+    bench_stop();
+}
+
+void loop(void)
+{
+}
@@ -3,8 +3,15 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "compiler.h"
+#include "memory.h"
 #include "variant.h"
 #include "HardwareSerial.h"
+#include "events.h"
+#include "trace.h"
+#include "stack.h"
+#include "log.h"
+#include "crc.h"
 #include "interrupt.h"
 
 // Arduino Pin Definitions (map to STC8G pins)
@@ -138,6 +145,10 @@ void clock_init(void);
 // Timer functions
 uint32_t micros(void);
 uint32_t millis(void);
+void millis_credit_us(uint32_t us);  // Account for time the tick was stopped
+
+// Single-cycle no-operation
+#define NOP() __asm__("nop")
 
 void init(void);
 
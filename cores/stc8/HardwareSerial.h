@@ -2,6 +2,7 @@
 #define HARDWARESERIAL_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "Arduino.h"
 
 // Pin selection constants
@@ -31,4 +32,30 @@ typedef struct
 // External Serial object
 extern Serial_t Serial;
 
+// Serial methods as plain functions. Serial links every method above;
+// calling these directly links only the ones a sketch uses.
+void serialBegin(uint32_t baud);
+void serialBeginWithPins(uint32_t baud, UartPinSelect_t pins) __reentrant;
+void serialEnd(void);
+uint8_t serialAvailable(void);
+int serialRead(void);
+void serialWrite(uint8_t byte);
+void serialPrint(const char *str);
+void serialPrintln(const char *str);
+void serialPrintNumber(int32_t num) __reentrant;
+void serialReadString(char *buffer, uint8_t max_len) __reentrant;
+char *serialReadLine(void) __reentrant; // Returns pointer to static buffer
+
+// printf subset, streamed to the UART: %d %i %u %x %X %c %s %%, the l
+// modifier for long, width and 0 flag, and %.Nf for integers scaled by
+// 10^N (%.2f of 1234 prints 12.34). fmt must be a string in flash.
+// Not a Serial member, so only sketches that call it link the formatter.
+void serialPrintf(const __code char *fmt, ...) __reentrant;
+
+// Non-blocking line reader for protothreads and polling loops.
+// Collects received characters into buffer and returns true once a
+// CR/LF-terminated line is complete (empty lines are skipped). Keep
+// passing the same buffer until it returns true.
+bool serialReadLineAsync(char *buffer, uint8_t max_len);
+
 #endif // HARDWARESERIAL_H
\ No newline at end of file
@@ -0,0 +1,47 @@
+#ifndef COMPILER_H
+#define COMPILER_H
+
+// Compiler portability layer. SDCC builds get the real 8051 keywords;
+// any other compiler (gcc/clang on the build machine) gets plain C so the
+// core and driver sources can be compiled into host binaries against the
+// SFR and peripheral model in tools/host.
+//
+//   SFR(name, addr)  Special function register at addr (0x80-0xFF)
+//   XFR(name, addr)  Extended SFR in XDATA (0xFExx, needs P_SW2.EAXFR)
+//   HW_WAIT(reg)     Body of a busy-wait loop polling reg. Empty on the
+//                    chip; on the host it runs the peripheral model.
+
+#if defined(__SDCC)
+
+#define SFR(name, addr) __sfr __at(addr) name
+#define XFR(name, addr) __xdata __at(addr) volatile uint8_t name
+
+#define HW_WAIT(reg)
+
+#else
+
+#include <stdint.h>
+
+#define __data
+#define __idata
+#define __pdata
+#define __xdata
+#define __code
+#define __at(addr)
+#define __interrupt(n)
+#define __reentrant
+
+// tools/host/host_sfr.c defines HOST_SFR_STORAGE to allocate the registers
+#ifdef HOST_SFR_STORAGE
+#define SFR(name, addr) volatile uint8_t name
+#else
+#define SFR(name, addr) extern volatile uint8_t name
+#endif
+#define XFR(name, addr) SFR(name, addr)
+
+void host_hw_wait(volatile uint8_t *reg);
+#define HW_WAIT(reg) host_hw_wait(&(reg))
+
+#endif
+
+#endif // COMPILER_H
@@ -0,0 +1,73 @@
+#ifndef CRC_H
+#define CRC_H
+
+#include <stdint.h>
+#include "Arduino.h"
+
+// Table-driven CRCs and checksums. Every function takes the running
+// value and returns the updated one, so data can be fed in pieces:
+//
+//   crc = crc16(CRC16_INIT, header, sizeof(header));
+//   crc = crc16(crc, payload, len);
+//
+// Update() looks up 4 bits at a time in a 16-entry table (16-64 bytes
+// of flash). UpdateFast() and the buffer functions look up a whole byte
+// (256 bytes of table per 8 bits of CRC). Tables live in __code.
+//
+//   CRC-8   Dallas/Maxim 1-Wire: poly 0x31 reflected, init 0x00
+//   CRC-16  CCITT: poly 0x1021, init 0xFFFF (CCITT-FALSE) or 0x0000 (XMODEM)
+//   CRC-32  IEEE 802.3 / zlib: poly 0x04C11DB7 reflected, init and final
+//           XOR 0xFFFFFFFF
+
+#define CRC8_INIT   0x00
+#define CRC16_INIT  0xFFFF
+#define CRC32_INIT  0xFFFFFFFFUL
+
+#define crc32Final(crc) ((crc) ^ 0xFFFFFFFFUL)
+
+/**
+ * @brief Add one byte, 16-entry table
+ */
+uint8_t crc8Update(uint8_t crc, uint8_t byte);
+uint16_t crc16Update(uint16_t crc, uint8_t byte);
+uint32_t crc32Update(uint32_t crc, uint8_t byte);
+
+/**
+ * @brief Add one byte, 256-entry table
+ */
+uint8_t crc8UpdateFast(uint8_t crc, uint8_t byte);
+uint16_t crc16UpdateFast(uint16_t crc, uint8_t byte);
+uint32_t crc32UpdateFast(uint32_t crc, uint8_t byte);
+
+/**
+ * @brief Add a buffer anywhere in memory (generic pointer), 256-entry table
+ */
+uint8_t crc8(uint8_t crc, const uint8_t *buf, uint16_t len);
+uint16_t crc16(uint16_t crc, const uint8_t *buf, uint16_t len);
+uint32_t crc32(uint32_t crc, const uint8_t *buf, uint16_t len);
+
+/**
+ * @brief Add a buffer in XRAM; faster than the generic version
+ */
+uint8_t crc8Xdata(uint8_t crc, const __xdata uint8_t *buf, uint16_t len);
+uint16_t crc16Xdata(uint16_t crc, const __xdata uint8_t *buf, uint16_t len);
+uint32_t crc32Xdata(uint32_t crc, const __xdata uint8_t *buf, uint16_t len);
+
+/**
+ * @brief Add a buffer in internal RAM; faster than the generic version
+ */
+uint8_t crc8Data(uint8_t crc, const __data uint8_t *buf, uint8_t len);
+uint16_t crc16Data(uint16_t crc, const __data uint8_t *buf, uint8_t len);
+uint32_t crc32Data(uint32_t crc, const __data uint8_t *buf, uint8_t len);
+
+/**
+ * @brief 8-bit sum of the bytes (start with 0)
+ */
+uint8_t checksum8(uint8_t sum, const uint8_t *buf, uint16_t len);
+
+/**
+ * @brief Fletcher-16 (start with 0); high byte is the sum of sums
+ */
+uint16_t fletcher16(uint16_t sum, const uint8_t *buf, uint16_t len);
+
+#endif // CRC_H
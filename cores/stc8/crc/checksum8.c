@@ -0,0 +1,9 @@
+#include "crc_private.h"
+
+uint8_t checksum8(uint8_t sum, const uint8_t *buf, uint16_t len)
+{
+    while (len--) {
+        sum += *buf++;
+    }
+    return sum;
+}
@@ -0,0 +1,9 @@
+#include "crc_private.h"
+
+uint16_t crc16(uint16_t crc, const uint8_t *buf, uint16_t len)
+{
+    while (len--) {
+        CRC16_STEP(crc, *buf++);
+    }
+    return crc;
+}
@@ -0,0 +1,10 @@
+#include "crc_private.h"
+
+// Same as crc16() with an @R0/@R1 walk over internal RAM
+uint16_t crc16Data(uint16_t crc, const __data uint8_t *buf, uint8_t len)
+{
+    while (len--) {
+        CRC16_STEP(crc, *buf++);
+    }
+    return crc;
+}
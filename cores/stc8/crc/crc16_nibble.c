@@ -0,0 +1,15 @@
+#include "crc_private.h"
+
+// CRC-16/CCITT, 4 bits per lookup: 32 bytes of table
+static const __code uint16_t crc16_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t crc16Update(uint16_t crc, uint8_t byte)
+{
+    crc ^= (uint16_t)byte << 8;
+    crc = (crc << 4) ^ crc16_nibble[crc >> 12];
+    crc = (crc << 4) ^ crc16_nibble[crc >> 12];
+    return crc;
+}
@@ -0,0 +1,10 @@
+#include "crc_private.h"
+
+// Same as crc16() with a DPTR walk instead of generic pointer calls
+uint16_t crc16Xdata(uint16_t crc, const __xdata uint8_t *buf, uint16_t len)
+{
+    while (len--) {
+        CRC16_STEP(crc, *buf++);
+    }
+    return crc;
+}
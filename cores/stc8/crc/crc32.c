@@ -0,0 +1,9 @@
+#include "crc_private.h"
+
+uint32_t crc32(uint32_t crc, const uint8_t *buf, uint16_t len)
+{
+    while (len--) {
+        CRC32_STEP(crc, *buf++);
+    }
+    return crc;
+}
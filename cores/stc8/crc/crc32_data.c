@@ -0,0 +1,10 @@
+#include "crc_private.h"
+
+// Same as crc32() with an @R0/@R1 walk over internal RAM
+uint32_t crc32Data(uint32_t crc, const __data uint8_t *buf, uint8_t len)
+{
+    while (len--) {
+        CRC32_STEP(crc, *buf++);
+    }
+    return crc;
+}
@@ -0,0 +1,18 @@
+#include "crc_private.h"
+
+// CRC-32 (polynomial 0x04C11DB7, reflected), 4 bits per lookup: 64 bytes
+// of table
+static const __code uint32_t crc32_nibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t crc32Update(uint32_t crc, uint8_t byte)
+{
+    crc ^= byte;
+    crc = (crc >> 4) ^ crc32_nibble[(uint8_t)crc & 0x0F];
+    crc = (crc >> 4) ^ crc32_nibble[(uint8_t)crc & 0x0F];
+    return crc;
+}
@@ -0,0 +1,10 @@
+#include "crc_private.h"
+
+// Same as crc32() with a DPTR walk instead of generic pointer calls
+uint32_t crc32Xdata(uint32_t crc, const __xdata uint8_t *buf, uint16_t len)
+{
+    while (len--) {
+        CRC32_STEP(crc, *buf++);
+    }
+    return crc;
+}
@@ -0,0 +1,9 @@
+#include "crc_private.h"
+
+uint8_t crc8(uint8_t crc, const uint8_t *buf, uint16_t len)
+{
+    while (len--) {
+        CRC8_STEP(crc, *buf++);
+    }
+    return crc;
+}
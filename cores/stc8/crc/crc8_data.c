@@ -0,0 +1,10 @@
+#include "crc_private.h"
+
+// Same as crc8() with an @R0/@R1 walk over internal RAM
+uint8_t crc8Data(uint8_t crc, const __data uint8_t *buf, uint8_t len)
+{
+    while (len--) {
+        CRC8_STEP(crc, *buf++);
+    }
+    return crc;
+}
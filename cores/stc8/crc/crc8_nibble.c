@@ -0,0 +1,15 @@
+#include "crc_private.h"
+
+// CRC-8/MAXIM, 4 bits per lookup: 16 bytes of table
+static const __code uint8_t crc8_nibble[16] = {
+    0x00, 0x9D, 0x23, 0xBE, 0x46, 0xDB, 0x65, 0xF8,
+    0x8C, 0x11, 0xAF, 0x32, 0xCA, 0x57, 0xE9, 0x74
+};
+
+uint8_t crc8Update(uint8_t crc, uint8_t byte)
+{
+    crc ^= byte;
+    crc = (crc >> 4) ^ crc8_nibble[crc & 0x0F];
+    crc = (crc >> 4) ^ crc8_nibble[crc & 0x0F];
+    return crc;
+}
@@ -0,0 +1,10 @@
+#include "crc_private.h"
+
+// Same as crc8() with a DPTR walk instead of generic pointer calls
+uint8_t crc8Xdata(uint8_t crc, const __xdata uint8_t *buf, uint16_t len)
+{
+    while (len--) {
+        CRC8_STEP(crc, *buf++);
+    }
+    return crc;
+}
@@ -0,0 +1,37 @@
+#ifndef CRC_PRIVATE_H
+#define CRC_PRIVATE_H
+
+#include "Arduino.h"
+
+// Byte tables shared by the fast update and the buffer kernels. Each
+// function lives in its own file so the linker only pulls in the tables
+// a sketch uses.
+
+extern const __code uint8_t crc8_table[256];
+
+// CRC16 table entries split into high and low bytes, so a lookup is a
+// single MOVC each without scaling the index
+extern const __code uint8_t crc16_table_hi[256];
+extern const __code uint8_t crc16_table_lo[256];
+
+// CRC32 table entries split by byte, least significant first
+extern const __code uint8_t crc32_table_0[256];
+extern const __code uint8_t crc32_table_1[256];
+extern const __code uint8_t crc32_table_2[256];
+extern const __code uint8_t crc32_table_3[256];
+
+#define CRC8_STEP(crc, byte) ((crc) = crc8_table[(uint8_t)((crc) ^ (byte))])
+
+#define CRC16_STEP(crc, byte) do { \
+    uint8_t _i = (uint8_t)((crc) >> 8) ^ (byte); \
+    (crc) = ((uint16_t)((uint8_t)(crc) ^ crc16_table_hi[_i]) << 8) | crc16_table_lo[_i]; \
+} while(0)
+
+#define CRC32_STEP(crc, byte) do { \
+    uint8_t _i = (uint8_t)(crc) ^ (byte); \
+    (crc) = ((crc) >> 8) ^ (((uint32_t)crc32_table_3[_i] << 24) | \
+                            ((uint32_t)crc32_table_2[_i] << 16) | \
+                            ((uint16_t)crc32_table_1[_i] << 8) | crc32_table_0[_i]); \
+} while(0)
+
+#endif // CRC_PRIVATE_H
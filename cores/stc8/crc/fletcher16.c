@@ -0,0 +1,17 @@
+#include "crc_private.h"
+
+// Both sums modulo 255, folded with a compare instead of a division
+uint16_t fletcher16(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint8_t lo = (uint8_t)sum;
+    uint8_t hi = (uint8_t)(sum >> 8);
+    uint16_t acc;
+
+    while (len--) {
+        acc = (uint16_t)lo + *buf++;
+        lo = acc >= 255 ? (uint8_t)(acc - 255) : (uint8_t)acc;
+        acc = (uint16_t)hi + lo;
+        hi = acc >= 255 ? (uint8_t)(acc - 255) : (uint8_t)acc;
+    }
+    return ((uint16_t)hi << 8) | lo;
+}
@@ -0,0 +1,108 @@
+#include "Arduino.h"
+
+// Event records in paged XRAM by default (MOVX @Ri, faster than DPTR
+// access); indices stay in internal RAM for the ISRs
+EVENT_QUEUE_SPACE Event_t event_queue[EVENT_QUEUE_SIZE];
+volatile MEM_HOT uint8_t event_head = 0;
+volatile MEM_HOT uint8_t event_tail = 0;
+volatile MEM_HOT uint8_t event_mask = 0;
+volatile MEM_HOT uint8_t event_high_water = 0;
+volatile MEM_HOT uint8_t event_dropped = 0;
+
+// Handler table - moved to XRAM to save internal RAM
+static MEM_COLD EventHandler_t event_handlers[EVENT_SOURCES];
+
+// Latest payload per source for WAIT_EVENT(); main loop only
+static MEM_COLD uint16_t event_pending = 0;
+static MEM_COLD uint16_t event_payload[EVENT_SOURCES];
+
+// Let a core ISR post events for source
+static void event_enable_source(uint8_t source, bool enable) {
+    if (source >= 8) {
+        return;
+    }
+    CLEAR_BIT(IE, 7);  // EA = 0, event_mask is read by ISRs
+    if (enable) {
+        event_mask |= (uint8_t)(1 << source);
+    } else {
+        event_mask &= (uint8_t)~(1 << source);
+    }
+    SET_BIT(IE, 7);
+}
+
+bool onEvent(uint8_t source, EventHandler_t handler) {
+    if (source >= EVENT_SOURCES) {
+        return false;
+    }
+
+    event_handlers[source] = handler;
+    event_enable_source(source, handler != 0);
+    return true;
+}
+
+bool postEvent(uint8_t source, uint8_t data0, uint8_t data1) {
+    uint8_t dropped_before;
+    bool queued;
+
+    CLEAR_BIT(IE, 7);  // EA = 0, ISRs are the other producers
+    dropped_before = event_dropped;
+    EVENT_POST(source, data0, data1);
+    queued = (event_dropped == dropped_before);
+    SET_BIT(IE, 7);
+
+    return queued;
+}
+
+void dispatchEvents(void) {
+    static MEM_WARM Event_t event;  // Copy handed to the handler
+    EventHandler_t handler;
+
+    while (event_tail != event_head) {
+        event.source = event_queue[event_tail].source;
+        event.data0 = event_queue[event_tail].data0;
+        event.data1 = event_queue[event_tail].data1;
+        event.stamp = event_queue[event_tail].stamp;
+        event_tail = (event_tail + 1) & (EVENT_QUEUE_SIZE - 1);
+
+        if (event.source < EVENT_SOURCES) {
+            event_pending |= (uint16_t)1 << event.source;
+            event_payload[event.source] = MAKE_WORD(event.data1, event.data0);
+
+            handler = event_handlers[event.source];
+            if (handler) {
+                handler(&event);
+            }
+        }
+    }
+}
+
+void eventListen(uint8_t source) {
+    if (source < 8 && !EVENT_WANTED(source)) {
+        event_enable_source(source, true);
+    }
+}
+
+bool eventTake(uint8_t source) {
+    uint16_t bit = (uint16_t)1 << source;
+
+    if (source >= EVENT_SOURCES || !(event_pending & bit)) {
+        return false;
+    }
+    event_pending &= ~bit;
+    return true;
+}
+
+uint16_t eventPayload(uint8_t source) {
+    if (source >= EVENT_SOURCES) {
+        return 0;
+    }
+    return event_payload[source];
+}
+
+uint8_t eventHighWater(void) {
+    return event_high_water;
+}
+
+uint8_t eventDropped(void) {
+    return event_dropped;
+}
@@ -0,0 +1,130 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Queue depth - must be a power of two
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE 16
+#endif
+
+// Memory space of the queue records: __pdata (default) or __idata
+#ifndef EVENT_QUEUE_SPACE
+#define EVENT_QUEUE_SPACE __pdata
+#endif
+
+// Event sources. 0-7 are posted by core ISRs once a handler is set,
+// 8-15 are free for sketches and libraries.
+#define EVENT_SOURCE_INT0      0
+#define EVENT_SOURCE_INT1      1
+#define EVENT_SOURCE_INT2      2
+#define EVENT_SOURCE_INT3      3
+#define EVENT_SOURCE_INT4      4
+#define EVENT_SOURCE_SERIAL_RX 5
+#define EVENT_SOURCE_BUTTON    6  // Debounced pins, see debounce.h
+#define EVENT_SOURCE_USER      8
+#define EVENT_SOURCES          16
+
+// Queued event, 5 bytes
+typedef struct {
+    uint8_t source;  // EVENT_SOURCE_*
+    uint8_t data0;   // Pin level for INTx, received byte for SERIAL_RX
+    uint8_t data1;
+    uint16_t stamp;  // Low 16 bits of millis() when posted
+} Event_t;
+
+// Called from dispatchEvents() in the main loop, not in interrupt context
+typedef void (*EventHandler_t)(const Event_t *event);
+
+// Queue state, shared with the EVENT_POST() macro. The queue has several
+// producers (the INTx, UART and debounce ISRs and postEvent() in the
+// main loop) and one consumer, dispatchEvents(). Producers do not lock
+// against each other: a post is only safe where no other producer can
+// interrupt it, i.e. from ISRs of the same priority level, or with EA
+// cleared as postEvent() does.
+extern EVENT_QUEUE_SPACE Event_t event_queue[EVENT_QUEUE_SIZE];
+extern volatile MEM_HOT uint8_t event_head;
+extern volatile MEM_HOT uint8_t event_tail;
+extern volatile MEM_HOT uint8_t event_mask;  // Core sources with a handler
+extern volatile MEM_HOT uint8_t event_high_water;
+extern volatile MEM_HOT uint8_t event_dropped;
+
+/**
+ * @brief Queue an event from an ISR (expands inline, no call overhead)
+ *
+ * Safe from any ISR of the same priority; an ISR of a higher priority
+ * could interrupt another post and corrupt the queue. From the main
+ * loop use postEvent() instead.
+ */
+#define EVENT_POST(src, d0, d1) do { \
+    uint8_t _next = (event_head + 1) & (EVENT_QUEUE_SIZE - 1); \
+    if (_next != event_tail) { \
+        uint8_t _fill; \
+        event_queue[event_head].source = (src); \
+        event_queue[event_head].data0 = (d0); \
+        event_queue[event_head].data1 = (d1); \
+        event_queue[event_head].stamp = (uint16_t)_millis; \
+        event_head = _next; \
+        _fill = (_next - event_tail) & (EVENT_QUEUE_SIZE - 1); \
+        if (_fill > event_high_water) event_high_water = _fill; \
+    } else { \
+        event_dropped++; \
+    } \
+} while(0)
+
+// True if the core ISR for src should post events
+#define EVENT_WANTED(src) (event_mask & (1 << (src)))
+
+/**
+ * @brief Set the handler for an event source (0 to remove it)
+ * @return false if source is out of range
+ *
+ * Setting a handler for a core source (INTx, SERIAL_RX) makes its ISR
+ * post events.
+ */
+bool onEvent(uint8_t source, EventHandler_t handler);
+
+/**
+ * @brief Queue an event from the main loop
+ * @return false if the queue was full (counted as dropped)
+ */
+bool postEvent(uint8_t source, uint8_t data0, uint8_t data1);
+
+/**
+ * @brief Run the handlers of all queued events
+ *
+ * Called by main() after every loop(); call it from long-running code
+ * to keep events flowing.
+ */
+void dispatchEvents(void);
+
+/**
+ * @brief Make a core ISR post events for source without setting a handler
+ */
+void eventListen(uint8_t source);
+
+/**
+ * @brief Check and clear the "event seen" flag of a source
+ * @return true if dispatchEvents() saw an event from source since the
+ *         last call
+ */
+bool eventTake(uint8_t source);
+
+/**
+ * @brief Payload of the latest event from source (data1 << 8 | data0)
+ */
+uint16_t eventPayload(uint8_t source);
+
+/**
+ * @brief Highest number of events queued at once since reset
+ */
+uint8_t eventHighWater(void);
+
+/**
+ * @brief Number of events lost because the queue was full
+ */
+uint8_t eventDropped(void);
+
+#endif // EVENTS_H
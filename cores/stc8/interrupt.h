@@ -34,8 +34,15 @@
 // Function pointer type for ISR
 typedef void (*voidFuncPtr)(void);
 
+// Set by the INTx and UART1 ISRs; cleared by sleepFor() before power-down
+extern volatile MEM_HOT uint8_t wakeup_irq;
+
 // API functions
 void attachInterrupt(uint8_t interrupt, voidFuncPtr userFunc, uint8_t mode);
 void detachInterrupt(uint8_t interrupt);
 
+// Queue the interrupt as an event instead of running code in the ISR;
+// handler runs from dispatchEvents() with data0 = pin level at the edge
+void attachInterruptEvent(uint8_t interrupt, EventHandler_t handler, uint8_t mode);
+
 #endif // INTERRUPT_H
\ No newline at end of file
@@ -0,0 +1,9 @@
+#include "Arduino.h"
+
+// Placeholder for the ADC vector. main.c references every ISR, so without
+// this the vector table would pull the continuous ADC driver into every
+// sketch. As an archive member it only links when no driver object
+// defines adc_isr.
+void adc_isr(void) __interrupt(ADC_ISR_VECTOR)
+{
+}
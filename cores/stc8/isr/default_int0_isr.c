@@ -0,0 +1,8 @@
+#include "Arduino.h"
+
+// Placeholder for the INT0 vector. Only attachInterrupt() and friends
+// link the real ISR; as an archive member this one only links when no
+// driver object defines INT0_ISR.
+void INT0_ISR(void) __interrupt(INT0_ISR_VECTOR)
+{
+}
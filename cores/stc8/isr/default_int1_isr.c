@@ -0,0 +1,8 @@
+#include "Arduino.h"
+
+// Placeholder for the INT1 vector. Only attachInterrupt() and friends
+// link the real ISR; as an archive member this one only links when no
+// driver object defines INT1_ISR.
+void INT1_ISR(void) __interrupt(INT1_ISR_VECTOR)
+{
+}
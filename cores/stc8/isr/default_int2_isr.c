@@ -0,0 +1,8 @@
+#include "Arduino.h"
+
+// Placeholder for the INT2 vector. Only attachInterrupt() and friends
+// link the real ISR; as an archive member this one only links when no
+// driver object defines INT2_ISR.
+void INT2_ISR(void) __interrupt(INT2_ISR_VECTOR)
+{
+}
@@ -0,0 +1,8 @@
+#include "Arduino.h"
+
+// Placeholder for the INT3 vector. Only attachInterrupt() and friends
+// link the real ISR; as an archive member this one only links when no
+// driver object defines INT3_ISR.
+void INT3_ISR(void) __interrupt(INT3_ISR_VECTOR)
+{
+}
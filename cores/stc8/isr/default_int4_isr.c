@@ -0,0 +1,8 @@
+#include "Arduino.h"
+
+// Placeholder for the INT4 vector. Only attachInterrupt() and friends
+// link the real ISR; as an archive member this one only links when no
+// driver object defines INT4_ISR.
+void INT4_ISR(void) __interrupt(INT4_ISR_VECTOR)
+{
+}
@@ -0,0 +1,7 @@
+#include "Arduino.h"
+
+// Placeholder for the PCA vector; the input capture driver defines the
+// real pca_isr. See default_adc_isr.c.
+void pca_isr(void) __interrupt(PCA_ISR_VECTOR)
+{
+}
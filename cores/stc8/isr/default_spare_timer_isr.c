@@ -0,0 +1,11 @@
+#include "Arduino.h"
+
+// Placeholder for the TIMER_SPARE vector; timer_periodic.c defines the
+// real dispatcher. See default_adc_isr.c.
+#if TICK_TIMER == 2
+void timer0_isr(void) __interrupt(TIMER0_ISR_VECTOR)
+#else
+void timer2_isr(void) __interrupt(TIMER2_ISR_VECTOR)
+#endif
+{
+}
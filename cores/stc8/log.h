@@ -0,0 +1,132 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+#include "Arduino.h"
+
+// Levelled logging over Serial. Calls above LOG_LEVEL compile to nothing,
+// arguments included; set the level from build.extra_flags, e.g.
+// -DLOG_LEVEL=LOG_LEVEL_INFO.
+//
+//   LOG_INFO("temp %d.%u C", whole, tenths);
+//
+// Lines are printed with serialPrintf() and take up to 3 arguments.
+// Binary mode sends integers only, so keep to %d %u %x %X %c and %.Nf
+// there. Main loop only, not from ISRs.
+//
+// With -DLOG_BINARY=1 the format strings are not compiled in at all. Each
+// call sends a frame with the call site (file id, line) and the raw
+// arguments; tools/log-decode.py rebuilds the text from the table that
+// is written next to the build output.
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_NONE
+#endif
+
+#ifndef LOG_BINARY
+#define LOG_BINARY 0
+#endif
+
+// Hash of the source file name, passed by the compile wrapper (sdcc.sh)
+#ifndef LOG_FILE_ID
+#define LOG_FILE_ID 0
+#endif
+
+#define LOG_MAX_ARGS 3
+
+// Binary frame: LOG_FRAME_START, file id and line (16-bit, LSB first),
+// argument count, then each argument as a zigzag varint (1 byte for
+// -64..63)
+#define LOG_FRAME_START 0x1E
+
+// Call being logged, filled in by the macros before log_send()
+typedef struct {
+    uint16_t file;
+    uint16_t line;
+    uint8_t argc;
+    int32_t arg[LOG_MAX_ARGS];
+} LogCall_t;
+
+extern MEM_COLD LogCall_t log_call;
+
+/**
+ * @brief Send log_call as a binary frame (LOG_BINARY=1)
+ */
+void log_send(void);
+
+// Argument count dispatch: LOG_NARGS(fmt, a, b) is 3
+#define LOG_NARGS(...) LOG_NARGS_(__VA_ARGS__, TOO_MANY, TOO_MANY, TOO_MANY, 4, 3, 2, 1, 0)
+#define LOG_NARGS_(_1, _2, _3, _4, _5, _6, _7, N, ...) N
+#define LOG_CAT(a, b) LOG_CAT_(a, b)
+#define LOG_CAT_(a, b) a##b
+
+#define LOG_ARGS_1(fmt) \
+    log_call.argc = 0
+#define LOG_ARGS_2(fmt, a) \
+    log_call.arg[0] = (int32_t)(a); log_call.argc = 1
+#define LOG_ARGS_3(fmt, a, b) \
+    log_call.arg[0] = (int32_t)(a); log_call.arg[1] = (int32_t)(b); log_call.argc = 2
+#define LOG_ARGS_4(fmt, a, b, c) \
+    log_call.arg[0] = (int32_t)(a); log_call.arg[1] = (int32_t)(b); \
+    log_call.arg[2] = (int32_t)(c); log_call.argc = 3
+
+// Text mode: the level prefix and line end are joined to the format
+#define LOG_TEXT_1(prefix, fmt) \
+    serialPrintf(prefix fmt "\r\n")
+#define LOG_TEXT_2(prefix, fmt, a) \
+    serialPrintf(prefix fmt "\r\n", a)
+#define LOG_TEXT_3(prefix, fmt, a, b) \
+    serialPrintf(prefix fmt "\r\n", a, b)
+#define LOG_TEXT_4(prefix, fmt, a, b, c) \
+    serialPrintf(prefix fmt "\r\n", a, b, c)
+
+// More than LOG_MAX_ARGS arguments: compile error naming the limit
+#define LOG_ARGS_TOO_MANY(...) LOG_takes_at_most_3_arguments
+#define LOG_TEXT_TOO_MANY(...) LOG_takes_at_most_3_arguments
+
+#if LOG_BINARY
+#define LOG_AT(prefix, ...) do { \
+    LOG_CAT(LOG_ARGS_, LOG_NARGS(__VA_ARGS__))(__VA_ARGS__); \
+    log_call.file = LOG_FILE_ID; \
+    log_call.line = __LINE__; \
+    log_send(); \
+} while(0)
+#else
+#define LOG_AT(prefix, ...) do { \
+    LOG_CAT(LOG_TEXT_, LOG_NARGS(__VA_ARGS__))(prefix, __VA_ARGS__); \
+} while(0)
+#endif
+
+#define LOG_OFF(...) do { } while(0)
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) LOG_AT("E: ", __VA_ARGS__)
+#else
+#define LOG_ERROR(...) LOG_OFF(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) LOG_AT("W: ", __VA_ARGS__)
+#else
+#define LOG_WARN(...) LOG_OFF(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) LOG_AT("I: ", __VA_ARGS__)
+#else
+#define LOG_INFO(...) LOG_OFF(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) LOG_AT("D: ", __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) LOG_OFF(__VA_ARGS__)
+#endif
+
+#endif // LOG_H
@@ -0,0 +1,5 @@
+#include "Arduino.h"
+#include "log.h"
+
+// Arguments of the call being logged, written by the LOG_x() macros
+MEM_COLD LogCall_t log_call;
@@ -0,0 +1,35 @@
+#include "Arduino.h"
+#include "log.h"
+
+static void log_send_u16(uint16_t value)
+{
+    serialWrite((uint8_t)value);
+    serialWrite((uint8_t)(value >> 8));
+}
+
+// Binary frame for tools/log-decode.py; the format string stays on the host
+void log_send(void)
+{
+    uint8_t i;
+    uint32_t value;
+
+    serialWrite(LOG_FRAME_START);
+    log_send_u16(log_call.file);
+    log_send_u16(log_call.line);
+    serialWrite(log_call.argc);
+
+    for (i = 0; i < log_call.argc; i++) {
+        // Zigzag, so small negative numbers stay short
+        value = (uint32_t)log_call.arg[i] << 1;
+        if (log_call.arg[i] < 0) {
+            value = ~value;
+        }
+
+        // 7 bits per byte, bit 7 set when more follow
+        while (value > 0x7F) {
+            serialWrite((uint8_t)value | 0x80);
+            value >>= 7;
+        }
+        serialWrite((uint8_t)value);
+    }
+}
@@ -1,6 +1,10 @@
 #include "Arduino.h"
 
 // Forward declare user's interrupt handler
+// SDCC builds the vector table from the prototypes visible here, so every
+// ISR below is always referenced. Driver ISRs (INT0-INT4, adc_isr, pca_isr
+// and the TIMER_SPARE dispatcher) have empty placeholders in cores/stc8/isr
+// that only link when the driver itself is not used.
 extern void INT0_ISR(void) __interrupt(INT0_ISR_VECTOR);
 extern void INT1_ISR(void) __interrupt(INT1_ISR_VECTOR);
 extern void INT2_ISR(void) __interrupt(INT2_ISR_VECTOR);
@@ -8,6 +12,9 @@ extern void INT3_ISR(void) __interrupt(INT3_ISR_VECTOR);
 extern void INT4_ISR(void) __interrupt(INT4_ISR_VECTOR);
 extern void timer0_isr(void) __interrupt(TIMER0_ISR_VECTOR);
 extern void uart1_isr(void) __interrupt(UART1_ISR_VECTOR);
+extern void adc_isr(void) __interrupt(ADC_ISR_VECTOR);
+extern void pca_isr(void) __interrupt(PCA_ISR_VECTOR);
+extern void timer2_isr(void) __interrupt(TIMER2_ISR_VECTOR);
 
 
 extern void setup(void);
@@ -22,11 +29,13 @@ void init(void)
 // Main entry point
 void main(void)
 {
+    stack_paint();  // Only with STACK_CHECK=1
     init();
     setup();
 
     while (1)
     {
         loop();
+        dispatchEvents();
     }
 }
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+// Memory placement profiles, selected with Tools -> Memory Profile
+// (MEM_PROFILE). Every core and driver variable is declared with one of
+// the classes below instead of a fixed SDCC storage class:
+//
+//   MEM_HOT   Small state on ISR and timing fast paths: ring indices,
+//             flags, handler pointers, tick reload values
+//   MEM_WARM  Other state updated from ISRs: _millis, ADC filter,
+//             capture timestamps
+//   MEM_RING  ISR ring buffers (together they must fit the 256-byte pdata page)
+//   MEM_COLD  Settings and buffers only touched from the main loop
+//
+//   Profile   MEM_HOT   MEM_WARM  MEM_RING  MEM_COLD
+//   Balanced  __data    __xdata   __xdata   __xdata
+//   Speed     __data    __idata   __pdata   __xdata
+//   Small RAM __xdata   __xdata   __xdata   __xdata
+//
+// The event queue stays in __pdata in every profile (EVENT_QUEUE_SPACE).
+// In the speed profile it shares the page with the Serial (64 bytes), ADC
+// (32) and I2C (32) rings: 208 of 256 bytes.
+//
+// __data and __idata are single-cycle internal RAM but compete with the
+// stack; __pdata uses MOVX @Ri (no DPTR load); __xdata uses MOVX @DPTR.
+// Any class can be overridden with build.extra_flags, e.g. -DMEM_RING=__xdata.
+
+#define MEM_PROFILE_BALANCED 0
+#define MEM_PROFILE_SPEED    1
+#define MEM_PROFILE_SMALL    2
+
+#ifndef MEM_PROFILE
+#define MEM_PROFILE MEM_PROFILE_BALANCED
+#endif
+
+#if MEM_PROFILE == MEM_PROFILE_SPEED
+#define MEM_PROFILE_HOT  __data
+#define MEM_PROFILE_WARM __idata
+#define MEM_PROFILE_RING __pdata
+#elif MEM_PROFILE == MEM_PROFILE_SMALL
+#define MEM_PROFILE_HOT  __xdata
+#define MEM_PROFILE_WARM __xdata
+#define MEM_PROFILE_RING __xdata
+#elif MEM_PROFILE == MEM_PROFILE_BALANCED
+#define MEM_PROFILE_HOT  __data
+#define MEM_PROFILE_WARM __xdata
+#define MEM_PROFILE_RING __xdata
+#else
+#error "MEM_PROFILE must be 0 (balanced), 1 (speed) or 2 (small RAM)"
+#endif
+
+#ifndef MEM_HOT
+#define MEM_HOT MEM_PROFILE_HOT
+#endif
+
+#ifndef MEM_WARM
+#define MEM_WARM MEM_PROFILE_WARM
+#endif
+
+#ifndef MEM_RING
+#define MEM_RING MEM_PROFILE_RING
+#endif
+
+#ifndef MEM_COLD
+#define MEM_COLD __xdata
+#endif
+
+#endif // MEMORY_H
@@ -0,0 +1,107 @@
+#ifndef PT_H
+#define PT_H
+
+#include <stdint.h>
+#include "Arduino.h"
+
+// Stackless coroutines (protothreads). A thread is a function that
+// returns at every wait and resumes at the same line on the next call,
+// so it needs no stack of its own - a good fit for the 8051.
+//
+// Local variables are NOT kept across waits; keep state in static
+// variables or in a struct next to the Pt_t.
+//
+// Do not use switch statements inside a thread body.
+//
+// Example:
+//   static Pt_t blink;
+//
+//   PT_THREAD(blinkThread(Pt_t *pt)) {
+//     PT_BEGIN(pt);
+//     while (1) {
+//       digitalToggle(P5_5);
+//       WAIT_MS(pt, 500);
+//     }
+//     PT_END(pt);
+//   }
+//
+//   void loop() {
+//     blinkThread(&blink);
+//   }
+
+// Thread state: resume point and timestamp for WAIT_MS, 6 bytes
+typedef struct {
+    uint16_t lc;
+    uint32_t t0;
+} Pt_t;
+
+// Thread return values
+#define PT_WAITING 0
+#define PT_YIELDED 1
+#define PT_EXITED  2
+#define PT_ENDED   3
+
+// Declare a thread function
+#define PT_THREAD(name_args) char name_args
+
+// Prepare a thread to start from the beginning (all-zero Pt_t is also valid)
+#define PT_INIT(pt) ((pt)->lc = 0)
+
+// Start and end of the thread body
+#define PT_BEGIN(pt) { char _pt_yielded = 1; (void)_pt_yielded; switch ((pt)->lc) { case 0:
+#define PT_END(pt)   } PT_INIT(pt); return PT_ENDED; }
+
+/**
+ * @brief Return to the caller until cond is true
+ */
+#define WAIT_UNTIL(pt, cond) do { \
+    (pt)->lc = __LINE__; case __LINE__: \
+    if (!(cond)) return PT_WAITING; \
+} while(0)
+
+/**
+ * @brief Return to the caller while cond is true
+ */
+#define WAIT_WHILE(pt, cond) WAIT_UNTIL(pt, !(cond))
+
+/**
+ * @brief Non-blocking delay based on millis()
+ */
+#define WAIT_MS(pt, ms) do { \
+    (pt)->t0 = millis(); \
+    WAIT_UNTIL(pt, millis() - (pt)->t0 >= (uint32_t)(ms)); \
+} while(0)
+
+/**
+ * @brief Wait for an event from the event queue (see events.h)
+ *
+ * Resumes once dispatchEvents() has seen an event from source. Its
+ * payload is available with eventPayload(source) afterwards.
+ */
+#define WAIT_EVENT(pt, source) do { \
+    eventListen(source); \
+    WAIT_UNTIL(pt, eventTake(source)); \
+} while(0)
+
+/**
+ * @brief Run a child thread until it ends
+ */
+#define WAIT_THREAD(pt, thread) WAIT_WHILE(pt, PT_SCHEDULE(thread))
+
+/**
+ * @brief Give other threads one turn
+ */
+#define PT_YIELD(pt) do { \
+    _pt_yielded = 0; \
+    (pt)->lc = __LINE__; case __LINE__: \
+    if (!_pt_yielded) return PT_YIELDED; \
+} while(0)
+
+// Leave the thread; the next call starts from the beginning
+#define PT_RESTART(pt) do { PT_INIT(pt); return PT_WAITING; } while(0)
+#define PT_EXIT(pt)    do { PT_INIT(pt); return PT_EXITED; } while(0)
+
+// True while a thread has not ended
+#define PT_SCHEDULE(f) ((f) < PT_EXITED)
+
+#endif // PT_H
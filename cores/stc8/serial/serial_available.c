@@ -0,0 +1,6 @@
+#include "serial_private.h"
+
+uint8_t serialAvailable(void)
+{
+  return (SERIAL_RX_BUFFER_SIZE + serial_rx_head - serial_rx_tail) % SERIAL_RX_BUFFER_SIZE;
+}
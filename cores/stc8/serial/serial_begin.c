@@ -0,0 +1,123 @@
+#include "serial_private.h"
+
+// Move to XRAM to save internal RAM
+static MEM_COLD UartPinSelect_t current_pins = UART_PINS_DEFAULT;
+static MEM_COLD uint32_t current_baud = 0;
+
+// Calculate Timer1 reload value for baud rate using Mode 0 with 1T
+// Formula: reload = 65536 - (SYSclk / (4 * baudrate)), rounded
+static uint16_t calculate_timer1_reload(uint32_t baud)
+{
+  uint32_t reload;
+  reload = 65536UL - ((getSystemClock() / (2UL * baud) + 1) / 2);
+  return (uint16_t)reload;
+}
+
+// Keep the baud rate after a system clock change
+static void serial_clock_changed(void)
+{
+  uint16_t reload;
+
+  if (!READ_BIT(TCON, 6)) // Timer1 stopped, Serial not running
+  {
+    return;
+  }
+
+  reload = calculate_timer1_reload(current_baud);
+  CLEAR_BIT(TCON, 6);             // TR1 = 0
+  TH1 = (uint8_t)(reload >> 8);   // Loads RL_TH1/RL_TL1 too
+  TL1 = (uint8_t)(reload & 0xFF);
+  SET_BIT(TCON, 6);               // TR1 = 1
+}
+
+void serialBeginWithPins(uint32_t baud, UartPinSelect_t pins) __reentrant
+{
+  uint16_t reload;
+
+  // Timer1 is the baud rate generator
+  if (!timerClaim(TIMER_1, TIMER_OWNER_SERIAL))
+  {
+    return;
+  }
+
+  current_pins = pins;
+  current_baud = baud;
+
+  // Configure UART1 pin switching based on enum
+  switch (pins)
+  {
+  case UART_PINS_DEFAULT: // P3.0/P3.1
+    P_SW1 = (P_SW1 & 0x3F) | S1_S_P30_P31;
+    break;
+
+  case UART_PINS_P32_P33: // P3.2/P3.3
+    P_SW1 = (P_SW1 & 0x3F) | S1_S_P32_P33;
+    SET_BIT(P_SW2, 7);
+    CLEAR_BIT(P3M1, 2);
+    CLEAR_BIT(P3M0, 2);
+    CLEAR_BIT(P3M1, 3);
+    CLEAR_BIT(P3M0, 3);
+    CLEAR_BIT(P_SW2, 7);
+    break;
+
+  case UART_PINS_P54_P55: // P5.4/P5.5
+    P_SW1 = (P_SW1 & 0x3F) | S1_S_P54_P55;
+    SET_BIT(P_SW2, 7);
+    CLEAR_BIT(P5M1, 4);
+    CLEAR_BIT(P5M0, 4);
+    CLEAR_BIT(P5M1, 5);
+    CLEAR_BIT(P5M0, 5);
+    CLEAR_BIT(P_SW2, 7);
+    break;
+  }
+
+  // Configure UART1 for Mode 1 (8-bit UART, variable baud rate)
+  SCON = 0x50;
+
+  // Disable Timer1 while configuring
+  CLEAR_BIT(TCON, 6); // TR1 = 0
+
+  // Configure Timer1 for baud rate generation
+  // Set S1ST2 = 0 to use Timer1 as baud rate generator
+  CLEAR_BIT(AUXR, 0); // S1ST2 = 0
+
+  // Set T1x12 = 1 for 1T mode (SYSclk/1)
+  SET_BIT(AUXR, 6); // T1x12 = 1
+
+  // Configure Timer1 Mode 0 (16-bit auto-reload mode)
+  // TMOD[5:4] = 00 for Mode 0
+  CLEAR_BIT_MASK(TMOD, 0xF0); // Clear upper nibble (Timer1 bits)
+  CLEAR_BIT(TMOD, 7);         // GATE = 0
+  CLEAR_BIT(TMOD, 6);         // C/T = 0 (timer mode)
+  CLEAR_BIT(TMOD, 5);         // M1 = 0
+  CLEAR_BIT(TMOD, 4);         // M0 = 0  -> Mode 0
+
+  // Calculate reload value
+  reload = calculate_timer1_reload(baud);
+
+  // Set reload value (write when TR1=0 sets both TH1/TL1 and RL_TH1/RL_TL1)
+  TH1 = (uint8_t)(reload >> 8);   // High byte
+  TL1 = (uint8_t)(reload & 0xFF); // Low byte
+
+  // Clear Timer1 overflow flag
+  CLEAR_BIT(TCON, 7); // TF1 = 0
+
+  // Start Timer1
+  SET_BIT(TCON, 6); // TR1 = 1
+
+  // Reset RX buffer
+  serial_rx_head = 0;
+  serial_rx_tail = 0;
+
+  // Enable UART interrupt
+  SET_BIT(IE, 4); // ES = 1
+  SET_BIT(IE, 7); // EA = 1
+
+  clockAddListener(serial_clock_changed);
+}
+
+void serialBegin(uint32_t baud)
+{
+  // Use default pins
+  serialBeginWithPins(baud, UART_PINS_DEFAULT);
+}
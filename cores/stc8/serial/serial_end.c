@@ -0,0 +1,9 @@
+#include "serial_private.h"
+
+void serialEnd(void)
+{
+  CLEAR_BIT(IE, 4);
+  CLEAR_BIT(TCON, 6);
+  CLEAR_BIT(SCON, 4);
+  timerRelease(TIMER_1, TIMER_OWNER_SERIAL);
+}
@@ -0,0 +1,34 @@
+#include "serial_private.h"
+
+// Placement follows the memory profile (memory.h)
+volatile MEM_RING uint8_t serial_rx_buffer[SERIAL_RX_BUFFER_SIZE];
+volatile MEM_HOT uint8_t serial_rx_head = 0;
+volatile MEM_HOT uint8_t serial_rx_tail = 0;
+
+void uart1_isr(void) __interrupt(4)
+{
+  TRACE_RECORD(TRACE_ID_UART1);
+
+  // Handle receive interrupt
+  if (READ_BIT(SCON, 0)) // RI flag
+  {
+    uint8_t next_head = (serial_rx_head + 1) % SERIAL_RX_BUFFER_SIZE;
+    uint8_t received_byte = SBUF;
+
+    if (next_head != serial_rx_tail)
+    {
+      serial_rx_buffer[serial_rx_head] = received_byte;
+      serial_rx_head = next_head;
+    }
+
+    if (EVENT_WANTED(EVENT_SOURCE_SERIAL_RX))
+    {
+      EVENT_POST(EVENT_SOURCE_SERIAL_RX, received_byte, 0);
+    }
+
+    CLEAR_BIT(SCON, 0); // Clear RI
+    wakeup_irq = 1;
+  }
+
+  TRACE_RECORD(TRACE_END(TRACE_ID_UART1));
+}
@@ -0,0 +1,18 @@
+#include "serial_private.h"
+
+// Serial object instance. The initializer references every method, so
+// a sketch using Serial links all of them; calling the serial*()
+// functions directly links only the ones used.
+Serial_t Serial = {
+    .begin = serialBegin,
+    .beginWithPins = serialBeginWithPins,
+    .end = serialEnd,
+    .available = serialAvailable,
+    .read = serialRead,
+    .write = serialWrite,
+    .print = serialPrint,
+    .println = serialPrintln,
+    .printNumber = serialPrintNumber,
+    .readString = serialReadString,
+    .readLine = serialReadLine,
+};
@@ -0,0 +1,9 @@
+#include "serial_private.h"
+
+void serialPrint(const char *str)
+{
+  while (*str)
+  {
+    serialWrite(*str++);
+  }
+}
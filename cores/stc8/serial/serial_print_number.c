@@ -0,0 +1,47 @@
+#include "serial_private.h"
+
+// Print a number (supports int32_t)
+void serialPrintNumber(int32_t num) __reentrant
+{
+  char buffer[12]; // -2147483648 is 11 chars + null
+  char *ptr = buffer + sizeof(buffer) - 1;
+  uint32_t abs_num;
+  uint8_t is_negative = 0;
+
+  *ptr = '\0';
+
+  // Handle negative numbers
+  if (num < 0)
+  {
+    is_negative = 1;
+    abs_num = 0 - (uint32_t)num;  // -num overflows for INT32_MIN
+  }
+  else
+  {
+    abs_num = (uint32_t)num;
+  }
+
+  // Handle zero case
+  if (abs_num == 0)
+  {
+    *(--ptr) = '0';
+  }
+  else
+  {
+    // Convert to string (reverse order)
+    while (abs_num > 0)
+    {
+      *(--ptr) = '0' + (abs_num % 10);
+      abs_num /= 10;
+    }
+  }
+
+  // Add negative sign if needed
+  if (is_negative)
+  {
+    *(--ptr) = '-';
+  }
+
+  // Print the string
+  serialPrint(ptr);
+}
@@ -0,0 +1,175 @@
+#include <stdarg.h>
+#include "serial_private.h"
+
+// Conversion being printed. serialPrintf() is not reentrant: do not call
+// it from an ISR while the main loop may be printing. Read for every
+// digit, so MEM_WARM: internal RAM in the speed profile (memory.h).
+static MEM_WARM uint8_t printf_width;
+static MEM_WARM uint8_t printf_precision;  // Digits after the point (%.Nf)
+static MEM_WARM char printf_pad;           // ' ' or '0'
+static MEM_WARM char printf_hex_letter;    // 'a' for %x, 'A' for %X
+
+static const __code uint32_t printf_pow10[10] = {
+    1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL,
+    10000UL, 1000UL, 100UL, 10UL, 1UL
+};
+
+// Leading padding, with the sign before zeros or after spaces
+static void printf_pad_to(uint8_t len, bool negative)
+{
+    if (negative) {
+        len++;
+        if (printf_pad == '0') {
+            serialWrite('-');
+        }
+    }
+    while (len < printf_width) {
+        serialWrite(printf_pad);
+        len++;
+    }
+    if (negative && printf_pad != '0') {
+        serialWrite('-');
+    }
+}
+
+// Digits by repeated subtraction, most significant first: no 32-bit
+// division and no digit buffer
+static void printf_decimal(uint32_t value, bool negative)
+{
+    uint8_t digits = 10;
+    uint8_t i;
+    uint32_t step;
+    char digit;
+
+    while (digits > 1 && value < printf_pow10[10 - digits]) {
+        digits--;
+    }
+    if (digits <= printf_precision) {
+        digits = printf_precision + 1;  // 0.05, not .05
+    }
+    printf_pad_to(digits + (printf_precision ? 1 : 0), negative);
+
+    for (i = 10 - digits; i < 10; i++) {
+        if (i == 10 - printf_precision) {
+            serialWrite('.');
+        }
+        step = printf_pow10[i];
+        digit = '0';
+        while (value >= step) {
+            value -= step;
+            digit++;
+        }
+        serialWrite(digit);
+    }
+}
+
+static void printf_hex(uint32_t value)
+{
+    uint8_t digits = 8;
+    uint8_t nibble;
+
+    while (digits > 1 && !(value >> ((digits - 1) * 4))) {
+        digits--;
+    }
+    printf_pad_to(digits, false);
+
+    while (digits--) {
+        nibble = (uint8_t)(value >> (digits * 4)) & 0x0F;
+        serialWrite(nibble < 10 ? '0' + nibble : printf_hex_letter - 10 + nibble);
+    }
+}
+
+static void printf_string(const char *str)
+{
+    const char *end = str;
+
+    while (*end) {
+        end++;
+    }
+    printf_pad = ' ';
+    printf_pad_to((uint8_t)(end - str), false);
+    serialPrint(str);
+}
+
+// Formatted output straight to the UART, reading the format from flash
+void serialPrintf(const __code char *fmt, ...) __reentrant
+{
+    va_list args;
+    char c;
+    bool is_long;
+    int32_t value;
+
+    va_start(args, fmt);
+    while ((c = *fmt++)) {
+        if (c != '%') {
+            serialWrite(c);
+            continue;
+        }
+
+        printf_pad = ' ';
+        printf_width = 0;
+        printf_precision = 0;
+        c = *fmt++;
+        if (c == '0') {
+            printf_pad = '0';
+            c = *fmt++;
+        }
+        while (c >= '0' && c <= '9') {
+            printf_width = printf_width * 10 + (c - '0');
+            c = *fmt++;
+        }
+        if (c == '.') {
+            c = *fmt++;
+            while (c >= '0' && c <= '9') {
+                printf_precision = printf_precision * 10 + (c - '0');
+                c = *fmt++;
+            }
+            if (printf_precision > 9) {
+                printf_precision = 9;
+            }
+        }
+        is_long = false;
+        if (c == 'l') {
+            is_long = true;
+            c = *fmt++;
+        }
+
+        switch (c) {
+            case 'd':
+            case 'i':
+            case 'f':
+                value = is_long ? va_arg(args, long) : va_arg(args, int);
+                if (c != 'f') {
+                    printf_precision = 0;
+                }
+                if (value < 0) {
+                    printf_decimal(-(uint32_t)value, true);
+                } else {
+                    printf_decimal((uint32_t)value, false);
+                }
+                break;
+            case 'u':
+                printf_precision = 0;
+                printf_decimal(is_long ? va_arg(args, unsigned long) : va_arg(args, unsigned int), false);
+                break;
+            case 'x':
+            case 'X':
+                printf_hex_letter = c - ('x' - 'a');
+                printf_hex(is_long ? va_arg(args, unsigned long) : va_arg(args, unsigned int));
+                break;
+            case 'c':
+                serialWrite((char)va_arg(args, int));
+                break;
+            case 's':
+                printf_string(va_arg(args, const char *));
+                break;
+            case '\0':
+                fmt--;  // Format ends after '%'
+                break;
+            default:  // %% and unknown conversions print the character
+                serialWrite(c);
+                break;
+        }
+    }
+    va_end(args);
+}
@@ -0,0 +1,8 @@
+#include "serial_private.h"
+
+void serialPrintln(const char *str)
+{
+  serialPrint(str);
+  serialWrite('\r');
+  serialWrite('\n');
+}
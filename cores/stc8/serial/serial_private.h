@@ -0,0 +1,17 @@
+#ifndef SERIAL_PRIVATE_H
+#define SERIAL_PRIVATE_H
+
+#include "Arduino.h"
+
+// Shared state of the UART1 driver. Each public function lives in its
+// own file so the linker only pulls in what a sketch calls.
+
+// Circular buffer for RX only
+#define SERIAL_RX_BUFFER_SIZE 64
+
+// Filled by uart1_isr (serial_isr.c)
+extern volatile MEM_RING uint8_t serial_rx_buffer[SERIAL_RX_BUFFER_SIZE];
+extern volatile MEM_HOT uint8_t serial_rx_head;
+extern volatile MEM_HOT uint8_t serial_rx_tail;
+
+#endif // SERIAL_PRIVATE_H
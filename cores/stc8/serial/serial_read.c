@@ -0,0 +1,13 @@
+#include "serial_private.h"
+
+int serialRead(void)
+{
+  if (serial_rx_head == serial_rx_tail)
+  {
+    return -1;
+  }
+
+  int data = serial_rx_buffer[serial_rx_tail];
+  serial_rx_tail = (serial_rx_tail + 1) % SERIAL_RX_BUFFER_SIZE;
+  return data;
+}
@@ -0,0 +1,39 @@
+#include "serial_private.h"
+
+#define SERIAL_LINE_BUFFER_SIZE 64
+static MEM_COLD char serial_line_buffer[SERIAL_LINE_BUFFER_SIZE];
+
+char *serialReadLine(void) __reentrant
+{
+  uint8_t index = 0;
+  int c;
+  uint16_t timeout = 0;
+  const uint16_t max_timeout = 10000;
+
+  while (index < (sizeof(serial_line_buffer) - 1))
+  {
+    c = serialRead();
+
+    if (c == -1)
+    {
+      timeout++;
+      if (timeout >= max_timeout)
+      {
+        break;
+      }
+      continue;
+    }
+
+    timeout = 0;
+
+    if (c == '\n' || c == '\r')
+    {
+      break;
+    }
+
+    serial_line_buffer[index++] = (char)c;
+  }
+
+  serial_line_buffer[index] = '\0';
+  return serial_line_buffer;
+}
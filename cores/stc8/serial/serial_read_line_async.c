@@ -0,0 +1,28 @@
+#include "serial_private.h"
+
+static MEM_COLD uint8_t serial_async_len = 0; // Characters collected so far
+
+bool serialReadLineAsync(char *buffer, uint8_t max_len)
+{
+  int c;
+
+  while ((c = serialRead()) != -1)
+  {
+    if (c == '\n' || c == '\r')
+    {
+      if (serial_async_len == 0)
+      {
+        continue; // Skip empty lines and the LF of CRLF
+      }
+      buffer[serial_async_len] = '\0';
+      serial_async_len = 0;
+      return true;
+    }
+
+    if (serial_async_len < max_len - 1)
+    {
+      buffer[serial_async_len++] = (char)c;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,41 @@
+#include "serial_private.h"
+
+// Read string until newline or timeout (simple version)
+void serialReadString(char *buffer, uint8_t max_len) __reentrant
+{
+  uint8_t index = 0;
+  int c;
+  uint16_t timeout = 0;
+  const uint16_t max_timeout = 10000; // Adjust as needed
+
+  while (index < (max_len - 1))
+  {
+    c = serialRead();
+
+    if (c == -1)
+    {
+      // No data available, increment timeout
+      timeout++;
+      if (timeout >= max_timeout)
+      {
+        break;
+      }
+      continue;
+    }
+
+    // Reset timeout when data received
+    timeout = 0;
+
+    // Check for newline or carriage return
+    if (c == '\n' || c == '\r')
+    {
+      break;
+    }
+
+    // Add character to buffer
+    buffer[index++] = (char)c;
+  }
+
+  // Null terminate
+  buffer[index] = '\0';
+}
@@ -0,0 +1,12 @@
+#include "serial_private.h"
+
+// Blocking write - waits for previous transmission to complete
+void serialWrite(uint8_t byte)
+{
+  SBUF = byte; // Send the byte
+  // Wait for previous transmission to complete
+  while (!READ_BIT(SCON, 1)) // Wait while TI is 0
+    HW_WAIT(SCON);
+
+  CLEAR_BIT(SCON, 1); // Clear TI flag
+}
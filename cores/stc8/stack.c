@@ -0,0 +1,51 @@
+#include "Arduino.h"
+
+// Host builds (tools/host) have no 8051 stack to inspect
+#if STACK_CHECK && defined(__SDCC)
+
+// First stack byte, placed by the linker after data/idata (crtstart)
+extern __idata uint8_t _start__stack[];
+
+// Paint from just above the current SP: main() has only the return
+// address on the stack and interrupts are still disabled
+void stack_paint(void)
+{
+    uint8_t __idata *p = (uint8_t __idata *)(SP + 1);
+
+    do {
+        *p = STACK_PAINT_BYTE;
+    } while (++p);  // Stops after 0xFF wraps to 0
+}
+
+uint8_t stackHighWater(void)
+{
+    uint8_t __idata *p = (uint8_t __idata *)0xFF;
+
+    while (p != _start__stack && *p == STACK_PAINT_BYTE) {
+        p--;
+    }
+    return (uint8_t)p - (uint8_t)_start__stack + 1;
+}
+
+uint8_t stackSize(void)
+{
+    return (uint8_t)(0x100 - (uint8_t)_start__stack);
+}
+
+#elif STACK_CHECK
+
+void stack_paint(void)
+{
+}
+
+uint8_t stackHighWater(void)
+{
+    return 0;
+}
+
+uint8_t stackSize(void)
+{
+    return 0;
+}
+
+#endif
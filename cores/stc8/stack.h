@@ -0,0 +1,51 @@
+#ifndef STACK_H
+#define STACK_H
+
+#include <stdint.h>
+#include "Arduino.h"
+
+// Optional stack usage check, compiled in with Tools -> Stack Check
+// (STACK_CHECK=1). main() fills the unused stack with STACK_PAINT_BYTE
+// before init() and setup(); stackHighWater() finds the highest byte
+// that was overwritten since.
+//
+// The stack holds return addresses, ISR register saves and the locals of
+// __reentrant functions (serialPrintNumber(), serialBeginWithPins(),
+// wireRequestFrom(), ...). It runs from the end of data/idata up to 0xFF;
+// the linker prints the space left after each build.
+
+#ifndef STACK_CHECK
+#define STACK_CHECK 0
+#endif
+
+#define STACK_PAINT_BYTE 0xA5
+
+#if STACK_CHECK
+
+/**
+ * @brief Fill the unused stack with STACK_PAINT_BYTE (called by main())
+ */
+void stack_paint(void);
+
+/**
+ * @brief Most stack bytes in use at any time since startup
+ *
+ * A stack byte that happens to hold STACK_PAINT_BYTE is counted as free,
+ * so treat the result as a lower bound.
+ */
+uint8_t stackHighWater(void);
+
+/**
+ * @brief Total stack space, from the first stack byte to 0xFF
+ */
+uint8_t stackSize(void);
+
+#else
+
+#define stack_paint()
+#define stackHighWater() 0
+#define stackSize() 0
+
+#endif
+
+#endif // STACK_H
@@ -0,0 +1,77 @@
+#include "Arduino.h"
+
+#if TRACE
+
+// Records in XRAM, one array per field so TRACE_RECORD() indexes each
+// with the 8-bit slot number
+__xdata uint8_t trace_id[TRACE_SIZE];
+__xdata uint8_t trace_ms[TRACE_SIZE];
+__xdata uint8_t trace_th[TRACE_SIZE];
+__xdata uint8_t trace_tl[TRACE_SIZE];
+volatile MEM_HOT uint8_t trace_head = 0;
+volatile MEM_HOT uint8_t trace_on = 1;
+
+void traceStart(void) {
+    trace_on = 1;
+}
+
+void traceStop(void) {
+    trace_on = 0;
+}
+
+void traceClear(void) {
+    uint8_t i;
+    uint8_t was_on = trace_on;
+
+    trace_on = 0;
+    for (i = 0; i < TRACE_SIZE; i++) {
+        trace_id[i] = TRACE_ID_NONE;
+    }
+    trace_head = 0;
+    trace_on = was_on;
+}
+
+void traceEvent(uint8_t id) {
+    CLEAR_BIT(IE, 7);  // EA = 0, ISRs are the other producers
+    TRACE_RECORD(id);
+    SET_BIT(IE, 7);
+}
+
+void traceDump(void) {
+    uint8_t i;
+    uint8_t slot;
+    uint8_t count = 0;
+    uint8_t was_on = trace_on;
+    uint16_t cycles_per_ms = (uint16_t)(getSystemClock() / 1000UL);
+
+    trace_on = 0;
+
+    for (i = 0; i < TRACE_SIZE; i++) {
+        if (trace_id[i] != TRACE_ID_NONE) {
+            count++;
+        }
+    }
+
+    serialWrite('T');
+    serialWrite('R');
+    serialWrite('C');
+    serialWrite(count);
+    serialWrite(LOW_BYTE(cycles_per_ms));
+    serialWrite(HIGH_BYTE(cycles_per_ms));
+
+    // Oldest first: the slot at the head is the next to be overwritten
+    slot = trace_head;
+    for (i = 0; i < TRACE_SIZE; i++) {
+        if (trace_id[slot] != TRACE_ID_NONE) {
+            serialWrite(trace_id[slot]);
+            serialWrite(trace_ms[slot]);
+            serialWrite(trace_th[slot]);
+            serialWrite(trace_tl[slot]);
+        }
+        slot = (slot + 1) & (TRACE_SIZE - 1);
+    }
+
+    trace_on = was_on;
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Optional timing trace, compiled in with Tools -> Tracing (TRACE=1).
+// Each record is (id, low byte of millis(), raw tick timer count), kept in
+// an XRAM ring and sent by traceDump() for tools/trace-decode.py.
+// With TRACE=0 the macros expand to nothing and no trace code or data is
+// linked.
+
+#ifndef TRACE
+#define TRACE 0
+#endif
+
+// Ring depth - power of two up to 128, 4 bytes of XRAM per record
+#ifndef TRACE_SIZE
+#define TRACE_SIZE 64
+#endif
+
+#if TRACE_SIZE > 128 || (TRACE_SIZE & (TRACE_SIZE - 1))
+#error "TRACE_SIZE must be a power of two up to 128"
+#endif
+
+// Record ids. Bit 7 marks the end of a span; core ISRs record
+// TRACE_ID_x on entry and TRACE_END(TRACE_ID_x) on exit.
+#define TRACE_ID_NONE   0x00  // Empty slot
+#define TRACE_ID_INT0   0x01
+#define TRACE_ID_INT1   0x02
+#define TRACE_ID_INT2   0x03
+#define TRACE_ID_INT3   0x04
+#define TRACE_ID_INT4   0x05
+#define TRACE_ID_UART1  0x06
+#define TRACE_ID_TICK   0x07  // Tick timer ISR (Timer0 or Timer2)
+#define TRACE_ID_I2C    0x08  // One I2C bus command (i2c_wait)
+#define TRACE_ID_USER   0x20  // 0x20-0x7F are free for sketches
+#define TRACE_END(id)   ((id) | 0x80)
+
+#if TRACE
+
+// Tick timer counter, read without the wrap check of micros()
+#if TICK_TIMER == 2
+#define TRACE_TH T2H
+#define TRACE_TL T2L
+#else
+#define TRACE_TH TH0
+#define TRACE_TL TL0
+#endif
+
+// Ring state, shared with the TRACE() macro
+extern __xdata uint8_t trace_id[TRACE_SIZE];
+extern __xdata uint8_t trace_ms[TRACE_SIZE];
+extern __xdata uint8_t trace_th[TRACE_SIZE];
+extern __xdata uint8_t trace_tl[TRACE_SIZE];
+extern volatile MEM_HOT uint8_t trace_head;
+extern volatile MEM_HOT uint8_t trace_on;
+
+/**
+ * @brief Record an event from an ISR (expands inline, no call overhead)
+ *
+ * Safe from any ISR of the same priority; from the main loop use
+ * traceEvent() instead.
+ */
+#define TRACE_RECORD(id) do { \
+    if (trace_on) { \
+        uint8_t _slot = trace_head; \
+        trace_th[_slot] = TRACE_TH; \
+        trace_tl[_slot] = TRACE_TL; \
+        trace_ms[_slot] = (uint8_t)_millis; \
+        trace_id[_slot] = (id); \
+        trace_head = (_slot + 1) & (TRACE_SIZE - 1); \
+    } \
+} while(0)
+
+/**
+ * @brief Start recording (on by default)
+ */
+void traceStart(void);
+
+/**
+ * @brief Stop recording; the ring keeps its contents
+ */
+void traceStop(void);
+
+/**
+ * @brief Empty the ring
+ */
+void traceClear(void);
+
+/**
+ * @brief Record an event from the main loop
+ * @param id TRACE_ID_USER..0x7F, or TRACE_END() of one
+ */
+void traceEvent(uint8_t id);
+
+/**
+ * @brief Send the ring over Serial in binary, oldest record first
+ *
+ * Recording is paused while the dump is sent. Serial must be started.
+ * Format: "TRC", record count, tick timer clocks per ms (16-bit, LSB
+ * first), then 4 bytes per record: id, millis low byte, count high, low.
+ */
+void traceDump(void);
+
+#else
+
+#define TRACE_RECORD(id)
+#define traceStart()
+#define traceStop()
+#define traceClear()
+#define traceEvent(id)
+#define traceDump()
+
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,40 @@
+/*
+  AnalogRead
+  Reads a potentiometer on P3_3, first with a single blocking read,
+  then with continuous sampling filtered in the ADC interrupt.
+  
+  This example code is in the public domain.
+*/
+
+#define POT_PIN P3_3
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("ADC Test");
+
+  Serial.print("Single read: ");
+  Serial.printNumber(analogRead(POT_PIN));
+  Serial.println("");
+
+  // 16 conversions per 12-bit result at 1 kHz, averaged over 8 results
+  analogContinuousFilter(2, 3);
+  analogContinuousBegin(POT_PIN, 1000);
+}
+
+void loop() {
+  static uint32_t previousMillis = 0;
+  uint16_t value = 0;
+
+  // Drain the buffer so it never overflows
+  while (analogContinuousAvailable()) {
+    value = analogContinuousRead();
+  }
+
+  if (millis() - previousMillis >= 500) {
+    previousMillis = millis();
+    Serial.print("Filtered (12-bit): ");
+    Serial.printNumber(analogContinuousLatest());
+    Serial.println("");
+  }
+  (void)value;
+}
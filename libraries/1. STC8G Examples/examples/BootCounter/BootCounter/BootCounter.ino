@@ -0,0 +1,34 @@
+/*
+  BootCounter
+  Counts how many times the board has been reset and keeps the count
+  in the EEPROM key/value store.
+  
+  This example code is in the public domain.
+*/
+
+#define KEY_BOOTS 0
+
+void setup() {
+  uint16_t boots;
+
+  Serial.begin(115200);
+
+  boots = eepromRead(KEY_BOOTS);
+  if (boots == EEPROM_UNSET) {
+    boots = 0;
+  }
+  boots++;
+
+  eepromWrite(KEY_BOOTS, boots);
+  eepromCommit();
+
+  Serial.print("Boot count: ");
+  Serial.printNumber(boots);
+  Serial.println("");
+  Serial.print("Sector rotations: ");
+  Serial.printNumber(eepromGeneration());
+  Serial.println("");
+}
+
+void loop() {
+}
@@ -1,21 +1,41 @@
 /*
   Button
-  Reads a digital input on pin P3_2, controls LED on P5_5
-  
+  Debounced button on P3_2 (to GND) switches the LED on P5_5.
+  Holding it for one second is reported as a long press.
+
+  The button is sampled from the spare timer, so loop() is free.
+
   This example code is in the public domain.
 */
 
+void onButton(const Event_t *event) {
+  if (!(event->data0 & DEBOUNCE_PIN(P3_2))) {
+    return;
+  }
+
+  switch (event->data1) {
+    case DEBOUNCE_PRESS:
+      digitalWrite(P5_5, HIGH);
+      serialPrintln("Button Pressed");
+      break;
+
+    case DEBOUNCE_RELEASE:
+      digitalWrite(P5_5, LOW);
+      break;
+
+    case DEBOUNCE_LONG_PRESS:
+      serialPrintln("Long Press");
+      break;
+  }
+}
+
 void setup() {
-  Serial.begin(115200);
-  pinMode(P3_2, INPUT_PULLUP);
+  serialBegin(115200);
   pinMode(P5_5, OUTPUT);
+
+  debounceBegin(DEBOUNCE_PIN(P3_2), DEBOUNCE_RATE_DEFAULT_HZ);
+  onEvent(EVENT_SOURCE_BUTTON, onButton);
 }
 
 void loop() {
-  if (!digitalRead(P3_2)) {
-    digitalWrite(P5_5, HIGH);
-    Serial.println("Button Pressed");
-  } else {
-    digitalWrite(P5_5, LOW);
-  }
-}
\ No newline at end of file
+}
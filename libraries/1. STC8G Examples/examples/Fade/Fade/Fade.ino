@@ -0,0 +1,31 @@
+/*
+  Fade
+  Fades an LED on P5_4 (CCP2) using hardware PWM.
+  The PCA generates the waveform, so loop() only updates the duty cycle.
+  
+  This example code is in the public domain.
+*/
+
+#define LED_PIN P5_4
+
+uint8_t brightness = 0;
+int8_t fadeAmount = 5;
+
+void setup() {
+  // 8-bit resolution is the default, shown here for clarity
+  analogWriteResolution(PWM_RESOLUTION_8BIT);
+}
+
+void loop() {
+  analogWrite(LED_PIN, brightness);
+
+  // Reverse direction at the ends of the fade
+  if (brightness == 0 && fadeAmount < 0) {
+    fadeAmount = -fadeAmount;
+  } else if (brightness >= 250 && fadeAmount > 0) {
+    fadeAmount = -fadeAmount;
+  }
+  brightness += fadeAmount;
+
+  delay_ms(30);
+}
@@ -12,8 +12,8 @@ void button_isr() {
 }
 
 void setup() {
-  Serial.begin(115200);
-  Serial.println("Interrupt Test");
+  serialBegin(115200);
+  serialPrintln("Interrupt Test");
 
   // Note: P3_2 and P3_3 can using FALLING, RISING or CHANGE
   // Other pins only support FALLING
@@ -33,7 +33,7 @@ void setup() {
 void loop() {
   if (button_pressed) {
     button_pressed = 0;
-    Serial.println("Button pressed!");
+    serialPrintln("Button pressed!");
   }
   delay_ms(100);
 }
\ No newline at end of file
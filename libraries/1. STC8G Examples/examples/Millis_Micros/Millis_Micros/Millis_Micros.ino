@@ -9,7 +9,7 @@
 #define LED_PIN P5_5
 
 void setup() {
-  Serial.begin(9600);
+  serialBegin(9600);
 
   // Set LED pin as output
   pinMode(LED_PIN, OUTPUT);
@@ -28,14 +28,14 @@ void loop() {
 
   // Blink every 1 second (1,000,000 microseconds)
   if ((currentMicros - previousMicros) >= 1000000UL) {
-    Serial.println("Toggle LED");
+    serialPrintln("Toggle LED");
     previousMicros = currentMicros;
     digitalToggle(LED_PIN);
   }
 
   // Alternative using millis():
   // if ((currentMillis - previousMillis) >= 1000) {
-  //   Serial.println("Toggle LED");
+  //   serialPrintln("Toggle LED");
   //   previousMillis = currentMillis;
   //   digitalToggle(LED_PIN);
   // }
@@ -0,0 +1,60 @@
+/*
+  Protothreads
+  Runs two independent tasks in loop() without blocking: an LED on
+  P5_5 blinking at a rate set over serial, and a serial console that
+  reads lines like "250" to change the blink period.
+  
+  This example code is in the public domain.
+*/
+
+#include <pt.h>
+
+#define LED_PIN P5_5
+
+static Pt_t blinkPt;
+static Pt_t consolePt;
+static uint16_t blinkPeriod = 500;
+static char line[16];
+
+PT_THREAD(blinkTask(Pt_t *pt)) {
+  PT_BEGIN(pt);
+  while (1) {
+    digitalToggle(LED_PIN);
+    WAIT_MS(pt, blinkPeriod);
+  }
+  PT_END(pt);
+}
+
+PT_THREAD(consoleTask(Pt_t *pt)) {
+  static uint8_t i;
+  static uint16_t value;
+
+  PT_BEGIN(pt);
+  while (1) {
+    WAIT_UNTIL(pt, serialReadLineAsync(line, sizeof(line)));
+
+    value = 0;
+    for (i = 0; line[i] >= '0' && line[i] <= '9'; i++) {
+      value = value * 10 + (line[i] - '0');
+    }
+
+    if (value > 0) {
+      blinkPeriod = value;
+      Serial.print("Blink period: ");
+      Serial.printNumber(blinkPeriod);
+      Serial.println(" ms");
+    }
+  }
+  PT_END(pt);
+}
+
+void setup() {
+  pinMode(LED_PIN, OUTPUT);
+  Serial.begin(115200);
+  Serial.println("Type a blink period in ms");
+}
+
+void loop() {
+  blinkTask(&blinkPt);
+  consoleTask(&consolePt);
+}
@@ -0,0 +1,36 @@
+/*
+  PulseIn
+  Measures the frequency, duty cycle and pulse width of a signal on
+  P3_2 (CCP0). Edges are timestamped by the PCA in hardware.
+  
+  This example code is in the public domain.
+*/
+
+#define SIGNAL_PIN P3_2
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Input Capture Test");
+
+  // Count at the full system clock for the best resolution
+  analogWriteClock(PCA_CLOCK_SYSCLK);
+  captureBegin(SIGNAL_PIN, CAPTURE_BOTH);
+}
+
+void loop() {
+  uint16_t duty = captureDutyCycle(SIGNAL_PIN);
+
+  Serial.print("Frequency: ");
+  Serial.printNumber(captureFrequency(SIGNAL_PIN));
+  Serial.print(" Hz  Duty: ");
+  Serial.printNumber(duty / 10);
+  Serial.print(".");
+  Serial.printNumber(duty % 10);
+  Serial.println("%");
+
+  Serial.print("Pulse width: ");
+  Serial.printNumber(pulseIn(SIGNAL_PIN, HIGH, 100000UL));
+  Serial.println(" us");
+
+  delay_ms(1000);
+}
@@ -15,11 +15,11 @@ uint8_t dec_to_bcd(uint8_t dec) {
 // Initialize RTC with I2C pins
 bool RTC_begin(I2cPinSelect_t pins) {
     // Initialize I2C
-    Wire.beginWithPins(pins);
+    wireBeginWithPins(pins);
     
     // Test communication with RTC
-    Wire.beginTransmission(RTC_ADDRESS);
-    uint8_t error = Wire.endTransmission(true);
+    wireBeginTransmission(RTC_ADDRESS);
+    uint8_t error = wireEndTransmission(true);
     
     if (error == 0) {
         rtc_initialized = true;
@@ -34,17 +34,17 @@ bool RTC_setTime(uint8_t year, uint8_t month, uint8_t date,
                  uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t day) {
     if (!rtc_initialized) return false;
     
-    Wire.beginTransmission(RTC_ADDRESS);
-    Wire.write(0x00);  // Start at seconds register
-    Wire.write(dec_to_bcd(seconds) & 0x7F);  // Clear CH bit to start clock
-    Wire.write(dec_to_bcd(minutes));
-    Wire.write(dec_to_bcd(hours) & 0x3F);    // 24-hour mode
-    Wire.write(dec_to_bcd(day));
-    Wire.write(dec_to_bcd(date));
-    Wire.write(dec_to_bcd(month));
-    Wire.write(dec_to_bcd(year));
-    
-    return (Wire.endTransmission(true) == 0);
+    wireBeginTransmission(RTC_ADDRESS);
+    wireWrite(0x00);  // Start at seconds register
+    wireWrite(dec_to_bcd(seconds) & 0x7F);  // Clear CH bit to start clock
+    wireWrite(dec_to_bcd(minutes));
+    wireWrite(dec_to_bcd(hours) & 0x3F);    // 24-hour mode
+    wireWrite(dec_to_bcd(day));
+    wireWrite(dec_to_bcd(date));
+    wireWrite(dec_to_bcd(month));
+    wireWrite(dec_to_bcd(year));
+    
+    return (wireEndTransmission(true) == 0);
 }
 
 // Get RTC time
@@ -55,17 +55,17 @@ bool RTC_getTime(uint8_t *year, uint8_t *month, uint8_t *date,
     
     if (!rtc_initialized) return false;
     
-    Wire.beginTransmission(RTC_ADDRESS);
-    Wire.write(0x00);  // Start at seconds register
-    Wire.endTransmission(false);
+    wireBeginTransmission(RTC_ADDRESS);
+    wireWrite(0x00);  // Start at seconds register
+    wireEndTransmission(false);
     
-    if (Wire.requestFrom(RTC_ADDRESS, 7, true) < 7) {
+    if (wireRequestFrom(RTC_ADDRESS, 7, true) < 7) {
         return false;
     }
     
     // Read all data into temporary array first
     for (i = 0; i < 7; i++) {
-        data[i] = Wire.read();
+        data[i] = wireRead();
     }
     
     // Convert from BCD and store in output variables
@@ -84,15 +84,15 @@ bool RTC_getTime(uint8_t *year, uint8_t *month, uint8_t *date,
 bool RTC_isRunning(void) {
     if (!rtc_initialized) return false;
     
-    Wire.beginTransmission(RTC_ADDRESS);
-    Wire.write(0x00);  // Seconds register
-    Wire.endTransmission(false);
+    wireBeginTransmission(RTC_ADDRESS);
+    wireWrite(0x00);  // Seconds register
+    wireEndTransmission(false);
     
-    if (Wire.requestFrom(RTC_ADDRESS, 1, true) < 1) {
+    if (wireRequestFrom(RTC_ADDRESS, 1, true) < 1) {
         return false;
     }
     
-    uint8_t seconds = Wire.read();
+    uint8_t seconds = wireRead();
     return !(seconds & 0x80);  // CH bit = 0 means running
 }
 
@@ -103,19 +103,19 @@ void RTC_start(void) {
     if (!rtc_initialized) return;
     
     // Read current seconds value
-    Wire.beginTransmission(RTC_ADDRESS);
-    Wire.write(0x00);
-    Wire.endTransmission(false);
-    Wire.requestFrom(RTC_ADDRESS, 1, true);
-    seconds = Wire.read();
+    wireBeginTransmission(RTC_ADDRESS);
+    wireWrite(0x00);
+    wireEndTransmission(false);
+    wireRequestFrom(RTC_ADDRESS, 1, true);
+    seconds = wireRead();
     
     // Clear CH bit (bit 7) to start oscillator
     seconds &= 0x7F;
     
-    Wire.beginTransmission(RTC_ADDRESS);
-    Wire.write(0x00);
-    Wire.write(seconds);
-    Wire.endTransmission(true);
+    wireBeginTransmission(RTC_ADDRESS);
+    wireWrite(0x00);
+    wireWrite(seconds);
+    wireEndTransmission(true);
 }
 
 // Stop RTC oscillator
@@ -125,17 +125,17 @@ void RTC_stop(void) {
     if (!rtc_initialized) return;
     
     // Read current seconds value
-    Wire.beginTransmission(RTC_ADDRESS);
-    Wire.write(0x00);
-    Wire.endTransmission(false);
-    Wire.requestFrom(RTC_ADDRESS, 1, true);
-    seconds = Wire.read();
+    wireBeginTransmission(RTC_ADDRESS);
+    wireWrite(0x00);
+    wireEndTransmission(false);
+    wireRequestFrom(RTC_ADDRESS, 1, true);
+    seconds = wireRead();
     
     // Set CH bit (bit 7) to stop oscillator
     seconds |= 0x80;
     
-    Wire.beginTransmission(RTC_ADDRESS);
-    Wire.write(0x00);
-    Wire.write(seconds);
-    Wire.endTransmission(true);
+    wireBeginTransmission(RTC_ADDRESS);
+    wireWrite(0x00);
+    wireWrite(seconds);
+    wireEndTransmission(true);
 }
\ No newline at end of file
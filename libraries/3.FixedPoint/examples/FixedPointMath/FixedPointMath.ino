@@ -0,0 +1,61 @@
+/*
+  FixedPointMath
+  Prints a few results of the fixed-point functions, then scales an ADC
+  reading to volts and smooths it with a Q1.15 filter, all without the
+  software float library.
+
+  This example code is in the public domain.
+*/
+
+#include "fixed_point.h"
+
+#define POT_PIN P3_3
+
+// 10-bit reading to volts at a 3.3 V reference
+#define VOLTS_PER_COUNT Q16_16(3.3 / 1023)
+
+// Moving average over 4 samples
+static const __code q1_15_t taps[4] = {
+  Q1_15(0.25), Q1_15(0.25), Q1_15(0.25), Q1_15(0.25)
+};
+static q1_15_t samples[4];
+
+void setup() {
+  fixangle_t angle = 0;
+  uint8_t degrees;
+
+  serialBegin(115200);
+  serialPrintln("Fixed-point test");
+
+  serialPrint("sqrt(2) = ");
+  q16Print(q16Sqrt(Q16_16(2.0)), 4);
+  serialPrintln("");
+
+  for (degrees = 0; degrees <= 90; degrees += 15) {
+    serialPrintf("sin(%u) = %.4lf\r\n", degrees, q16ToScaled(q15ToQ16(fixSin(angle)), 4));
+    angle += FIXANGLE_DEG(15);
+  }
+
+  // 0x10000 is a full turn
+  serialPrintf("atan2(1, -1) = %u deg\r\n",
+               (uint16_t)(((uint32_t)fixAtan2(1, -1) * 360 + 0x8000) >> 16));
+}
+
+void loop() {
+  uint16_t raw = analogRead(POT_PIN);
+  q16_16_t volts = q16Mul(q16FromInt(raw), VOLTS_PER_COUNT);
+  q1_15_t filtered;
+  uint8_t i;
+
+  // Newest sample first, as a fraction of full scale
+  for (i = 3; i > 0; i--) {
+    samples[i] = samples[i - 1];
+  }
+  samples[0] = (q1_15_t)(raw << 5);
+  filtered = q15Dot(taps, samples, 4);
+
+  serialPrintf("raw %4u  volts %.3lf  filtered %.3lf\r\n", raw,
+               q16ToScaled(volts, 3),
+               q16ToScaled(q16Mul(q15ToQ16(filtered), Q16_16(3.3)), 3));
+  delay_ms(500);
+}
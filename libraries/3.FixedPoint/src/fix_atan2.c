@@ -0,0 +1,63 @@
+#include "fixed_private.h"
+
+// atan(i / 32) for i = 0..32, as fixangle_t (0x2000 = 45 degrees)
+static const __code uint16_t fix_atan_table[33] = {
+    0, 326, 651, 975, 1297, 1617, 1933, 2246,
+    2555, 2860, 3159, 3453, 3742, 4025, 4302, 4572,
+    4836, 5094, 5344, 5589, 5826, 6058, 6282, 6500,
+    6712, 6917, 7117, 7310, 7498, 7679, 7856, 8026,
+    8192
+};
+
+// num / den as a 16-bit fraction, num <= den
+static uint16_t fix_ratio(uint16_t num, uint16_t den)
+{
+    uint32_t remainder = num;
+    uint16_t ratio = 0;
+    uint8_t i;
+
+    for (i = 0; i < 16; i++) {
+        remainder <<= 1;
+        ratio <<= 1;
+        if (remainder >= den) {
+            remainder -= den;
+            ratio |= 1;
+        }
+    }
+    return ratio;
+}
+
+// atan(ratio) for ratio 0..0xFFFF (0..1)
+static uint16_t fix_atan(uint16_t ratio)
+{
+    uint8_t index = (uint8_t)(ratio >> 11);
+    uint16_t frac = ratio & 0x07FF;
+    uint16_t value = fix_atan_table[index];
+
+    return value + (uint16_t)(fixed_umul16(fix_atan_table[index + 1] - value, frac) >> 11);
+}
+
+fixangle_t fixAtan2(int16_t y, int16_t x)
+{
+    uint16_t ux = x < 0 ? -(uint16_t)x : (uint16_t)x;
+    uint16_t uy = y < 0 ? -(uint16_t)y : (uint16_t)y;
+    fixangle_t angle;
+
+    if (ux == 0 && uy == 0) {
+        return 0;
+    }
+
+    // Reduce to the first octant, then mirror back
+    if (uy <= ux) {
+        angle = fix_atan(fix_ratio(uy, ux));
+    } else {
+        angle = 0x4000 - fix_atan(fix_ratio(ux, uy));
+    }
+    if (x < 0) {
+        angle = 0x8000 - angle;
+    }
+    if (y < 0) {
+        angle = -angle;
+    }
+    return angle;
+}
@@ -0,0 +1,44 @@
+#include "fixed_private.h"
+
+// sin() over the first quadrant in 64 steps, scaled by 32768
+static const __code uint16_t fix_sin_table[65] = {
+    0, 804, 1608, 2411, 3212, 4011, 4808, 5602,
+    6393, 7180, 7962, 8740, 9512, 10279, 11039, 11793,
+    12540, 13279, 14010, 14733, 15447, 16151, 16846, 17531,
+    18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595,
+    23170, 23732, 24279, 24812, 25330, 25833, 26320, 26791,
+    27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957,
+    30274, 30572, 30853, 31114, 31357, 31581, 31786, 31972,
+    32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758,
+    32768
+};
+
+q1_15_t fixSin(fixangle_t angle)
+{
+    uint16_t offset = angle & 0x3FFF;  // Position inside the quadrant
+    uint8_t index;
+    uint8_t frac;
+    uint16_t value;
+
+    // Second and fourth quadrants run the table backwards
+    if (angle & 0x4000) {
+        offset = 0x4000 - offset;
+    }
+    index = (uint8_t)(offset >> 8);
+    frac = (uint8_t)offset;
+
+    value = fix_sin_table[index];
+    if (frac) {
+        value += (uint16_t)(fixed_umul16(fix_sin_table[index + 1] - value, frac) >> 8);
+    }
+
+    if (angle & 0x8000) {
+        return (q1_15_t)-(int32_t)value;
+    }
+    return value > 0x7FFF ? Q1_15_MAX : (q1_15_t)value;
+}
+
+q1_15_t fixCos(fixangle_t angle)
+{
+    return fixSin(angle + 0x4000);
+}
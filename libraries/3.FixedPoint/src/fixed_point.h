@@ -0,0 +1,168 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <stdint.h>
+#include "Arduino.h"
+
+// Fixed-point math without the software float library.
+//
+//   q8_8_t    int16_t, 8 fraction bits, -128 .. 127.996
+//   q16_16_t  int32_t, 16 fraction bits, -32768 .. 32767.99998
+//   q1_15_t   int16_t, 15 fraction bits, -1 .. 0.99997
+//   fixangle_t  uint16_t, a full turn is 0x10000 (0x4000 = 90 degrees)
+//
+// Arithmetic saturates at the limits of the type instead of wrapping.
+// Multiplies are built from 8x8 products, which SDCC compiles to MUL AB,
+// instead of calling the 32x32 long multiply.
+// The functions are not reentrant: call them from the main loop or
+// from one ISR, not both.
+
+typedef int16_t q8_8_t;
+typedef int32_t q16_16_t;
+typedef int16_t q1_15_t;
+typedef uint16_t fixangle_t;
+
+#define Q8_8_ONE    ((q8_8_t)0x0100)
+#define Q8_8_MAX    ((q8_8_t)0x7FFF)
+#define Q8_8_MIN    ((q8_8_t)-0x8000)
+#define Q16_16_ONE  ((q16_16_t)0x00010000L)
+#define Q16_16_MAX  ((q16_16_t)0x7FFFFFFFL)
+#define Q16_16_MIN  ((q16_16_t)(-0x7FFFFFFFL - 1))
+#define Q1_15_MAX   ((q1_15_t)0x7FFF)
+#define Q1_15_MIN   ((q1_15_t)-0x8000)
+
+// Constants from decimal literals, folded by the compiler: no float code
+// is linked as long as the argument is a constant
+#define Q8_8(x)   ((q8_8_t)((x) * 256.0 + ((x) < 0 ? -0.5 : 0.5)))
+#define Q16_16(x) ((q16_16_t)((x) * 65536.0 + ((x) < 0 ? -0.5 : 0.5)))
+#define Q1_15(x)  ((q1_15_t)((x) * 32768.0 + ((x) < 0 ? -0.5 : 0.5)))
+#define FIXANGLE_DEG(d) ((fixangle_t)(int32_t)((d) * 65536.0 / 360.0 + 0.5))
+
+// Integer conversions; to int truncates toward minus infinity
+#define q8FromInt(i)    ((q8_8_t)((i) * 256))
+#define q8ToInt(q)      ((int8_t)((q) >> 8))
+#define q16FromInt(i)   ((q16_16_t)(i) * 65536L)
+#define q16ToInt(q)     ((int16_t)((q) >> 16))
+#define q8ToQ16(q)      ((q16_16_t)(q) * 256)
+#define q15ToQ16(q)     ((q16_16_t)(q) * 2)
+
+// ====================================================================================
+// Q8.8
+// ====================================================================================
+
+q8_8_t q8AddSat(q8_8_t a, q8_8_t b);
+q8_8_t q8SubSat(q8_8_t a, q8_8_t b);
+
+/**
+ * @brief a * b, rounded and saturated
+ */
+q8_8_t q8Mul(q8_8_t a, q8_8_t b);
+
+/**
+ * @brief a / b, saturated; division by zero returns the limit of a's sign
+ */
+q8_8_t q8Div(q8_8_t a, q8_8_t b);
+
+/**
+ * @brief Q16.16 to Q8.8, rounded and saturated
+ */
+q8_8_t q16ToQ8(q16_16_t q);
+
+// ====================================================================================
+// Q16.16
+// ====================================================================================
+
+q16_16_t q16AddSat(q16_16_t a, q16_16_t b);
+q16_16_t q16SubSat(q16_16_t a, q16_16_t b);
+
+/**
+ * @brief a * b, rounded and saturated
+ */
+q16_16_t q16Mul(q16_16_t a, q16_16_t b);
+
+/**
+ * @brief a / b, saturated; division by zero returns the limit of a's sign
+ */
+q16_16_t q16Div(q16_16_t a, q16_16_t b);
+
+/**
+ * @brief Square root; negative input returns 0
+ */
+q16_16_t q16Sqrt(q16_16_t a);
+
+// ====================================================================================
+// Q1.15
+// ====================================================================================
+
+q1_15_t q15AddSat(q1_15_t a, q1_15_t b);
+q1_15_t q15SubSat(q1_15_t a, q1_15_t b);
+
+/**
+ * @brief a * b, rounded; -1 * -1 saturates to Q1_15_MAX
+ */
+q1_15_t q15Mul(q1_15_t a, q1_15_t b);
+
+/**
+ * @brief Multiply-accumulate: acc + a * b with the product in Q2.30
+ *
+ * The accumulator saturates instead of wrapping. Convert the result with
+ * q15FromAcc().
+ */
+int32_t q15Mac(int32_t acc, q1_15_t a, q1_15_t b);
+
+/**
+ * @brief Q2.30 accumulator back to Q1.15, rounded and saturated
+ */
+q1_15_t q15FromAcc(int32_t acc);
+
+/**
+ * @brief Dot product of two vectors, e.g. FIR taps and samples
+ * @param a First vector (RAM or __code)
+ * @param b Second vector
+ * @param n Number of elements
+ * @return Saturated sum of the products
+ */
+q1_15_t q15Dot(const q1_15_t *a, const q1_15_t *b, uint8_t n);
+
+// ====================================================================================
+// Trigonometry (__code tables with linear interpolation)
+// ====================================================================================
+
+/**
+ * @brief sin(angle), error below 0.0002
+ */
+q1_15_t fixSin(fixangle_t angle);
+
+/**
+ * @brief cos(angle), error below 0.0002
+ */
+q1_15_t fixCos(fixangle_t angle);
+
+/**
+ * @brief Angle of the vector (x, y), error below 0.02 degrees
+ * @return 0 for (0, 0)
+ */
+fixangle_t fixAtan2(int16_t y, int16_t x);
+
+// ====================================================================================
+// Printing
+// ====================================================================================
+
+/**
+ * @brief Q16.16 as an integer scaled by 10^decimals, rounded
+ *
+ * Prints with serialPrintf("%.Nlf"): q16ToScaled(v, 2) of 1.5 is 150,
+ * printed by "%.2lf" as 1.50.
+ * @param decimals 0..4
+ */
+int32_t q16ToScaled(q16_16_t q, uint8_t decimals);
+
+/**
+ * @brief Print a Q16.16 value over Serial
+ * @param decimals Digits after the point, 0..4
+ */
+void q16Print(q16_16_t q, uint8_t decimals);
+
+#define q8Print(q, decimals) q16Print(q8ToQ16(q), decimals)
+
+#endif // FIXED_POINT_H
@@ -0,0 +1,46 @@
+#include "fixed_private.h"
+
+static const __code uint16_t fixed_pow10[5] = { 1, 10, 100, 1000, 10000 };
+
+int32_t q16ToScaled(q16_16_t q, uint8_t decimals)
+{
+    uint32_t uq = (uint32_t)q;
+    uint16_t scale;
+    int32_t scaled;
+
+    if (decimals > 4) {
+        decimals = 4;
+    }
+    scale = fixed_pow10[decimals];
+    if (q < 0) {
+        uq = -uq;
+    }
+
+    // Integer and fraction parts separately, so nothing overflows
+    scaled = (int32_t)(fixed_umul16((uint16_t)(uq >> 16), scale) +
+                       ((fixed_umul16((uint16_t)uq, scale) + 0x8000) >> 16));
+    return q < 0 ? -scaled : scaled;
+}
+
+void q16Print(q16_16_t q, uint8_t decimals)
+{
+    int32_t scaled = q16ToScaled(q, decimals);
+
+    switch (decimals) {
+        case 0:
+            serialPrintf("%ld", scaled);
+            break;
+        case 1:
+            serialPrintf("%.1lf", scaled);
+            break;
+        case 2:
+            serialPrintf("%.2lf", scaled);
+            break;
+        case 3:
+            serialPrintf("%.3lf", scaled);
+            break;
+        default:
+            serialPrintf("%.4lf", scaled);
+            break;
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef FIXED_PRIVATE_H
+#define FIXED_PRIVATE_H
+
+#include "fixed_point.h"
+
+// Shared helpers. Each group of public functions lives in its own file
+// so the linker only pulls in what a sketch calls.
+
+/**
+ * @brief Unsigned 16x16 -> 32 multiply from four 8x8 products (MUL AB)
+ */
+uint32_t fixed_umul16(uint16_t a, uint16_t b);
+
+/**
+ * @brief Clamp to the int16_t range
+ */
+int16_t fixed_sat16(int32_t value);
+
+#endif // FIXED_PRIVATE_H
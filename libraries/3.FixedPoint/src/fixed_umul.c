@@ -0,0 +1,28 @@
+#include "fixed_private.h"
+
+// SDCC turns a 16x16 -> 32 multiply into a call to the 32x32 _mullong.
+// Each 8x8 product below compiles to a single MUL AB.
+uint32_t fixed_umul16(uint16_t a, uint16_t b)
+{
+    uint8_t al = (uint8_t)a;
+    uint8_t ah = (uint8_t)(a >> 8);
+    uint8_t bl = (uint8_t)b;
+    uint8_t bh = (uint8_t)(b >> 8);
+    uint32_t result;
+
+    result = ((uint32_t)((uint16_t)ah * bh) << 16) | ((uint16_t)al * bl);
+    result += (uint32_t)((uint16_t)ah * bl) << 8;
+    result += (uint32_t)((uint16_t)al * bh) << 8;
+    return result;
+}
+
+int16_t fixed_sat16(int32_t value)
+{
+    if (value > 32767) {
+        return 32767;
+    }
+    if (value < -32768) {
+        return -32768;
+    }
+    return (int16_t)value;
+}
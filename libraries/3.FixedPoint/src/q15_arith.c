@@ -0,0 +1,31 @@
+#include "fixed_private.h"
+
+q1_15_t q15AddSat(q1_15_t a, q1_15_t b)
+{
+    return fixed_sat16((int32_t)a + b);
+}
+
+q1_15_t q15SubSat(q1_15_t a, q1_15_t b)
+{
+    return fixed_sat16((int32_t)a - b);
+}
+
+q1_15_t q15Mul(q1_15_t a, q1_15_t b)
+{
+    bool negative = false;
+    uint16_t ua = (uint16_t)a;
+    uint16_t ub = (uint16_t)b;
+    int32_t product;
+
+    if (a < 0) {
+        ua = -ua;
+        negative = true;
+    }
+    if (b < 0) {
+        ub = -ub;
+        negative = !negative;
+    }
+
+    product = (int32_t)((fixed_umul16(ua, ub) + 0x4000) >> 15);
+    return fixed_sat16(negative ? -product : product);
+}
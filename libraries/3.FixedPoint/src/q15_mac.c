@@ -0,0 +1,51 @@
+#include "fixed_private.h"
+
+int32_t q15Mac(int32_t acc, q1_15_t a, q1_15_t b)
+{
+    bool negative = false;
+    uint16_t ua = (uint16_t)a;
+    uint16_t ub = (uint16_t)b;
+    int32_t product;
+
+    if (a < 0) {
+        ua = -ua;
+        negative = true;
+    }
+    if (b < 0) {
+        ub = -ub;
+        negative = !negative;
+    }
+
+    // At most 2^30, so the product itself always fits
+    product = (int32_t)fixed_umul16(ua, ub);
+    if (negative) {
+        if (acc < (int32_t)(-0x7FFFFFFFL - 1) + product) {
+            return -0x7FFFFFFFL - 1;
+        }
+        return acc - product;
+    }
+    if (acc > 0x7FFFFFFFL - product) {
+        return 0x7FFFFFFFL;
+    }
+    return acc + product;
+}
+
+q1_15_t q15FromAcc(int32_t acc)
+{
+    int32_t value = acc >> 15;
+
+    if (acc & 0x4000) {
+        value++;
+    }
+    return fixed_sat16(value);
+}
+
+q1_15_t q15Dot(const q1_15_t *a, const q1_15_t *b, uint8_t n)
+{
+    int32_t acc = 0;
+
+    while (n--) {
+        acc = q15Mac(acc, *a++, *b++);
+    }
+    return q15FromAcc(acc);
+}
@@ -0,0 +1,70 @@
+#include "fixed_private.h"
+
+q16_16_t q16AddSat(q16_16_t a, q16_16_t b)
+{
+    q16_16_t sum = (q16_16_t)((uint32_t)a + (uint32_t)b);
+
+    // Overflow when both operands have the same sign and the sum does not
+    if ((a < 0) == (b < 0) && (sum < 0) != (a < 0)) {
+        return a < 0 ? Q16_16_MIN : Q16_16_MAX;
+    }
+    return sum;
+}
+
+q16_16_t q16SubSat(q16_16_t a, q16_16_t b)
+{
+    q16_16_t diff = (q16_16_t)((uint32_t)a - (uint32_t)b);
+
+    if ((a < 0) != (b < 0) && (diff < 0) != (a < 0)) {
+        return a < 0 ? Q16_16_MIN : Q16_16_MAX;
+    }
+    return diff;
+}
+
+// 32x32 -> 64 bit product >> 16, from the four 16x16 partial products
+q16_16_t q16Mul(q16_16_t a, q16_16_t b)
+{
+    bool negative = false;
+    uint32_t ua = (uint32_t)a;
+    uint32_t ub = (uint32_t)b;
+    uint32_t result;
+    uint32_t part;
+    uint32_t limit;
+
+    if (a < 0) {
+        ua = -ua;
+        negative = true;
+    }
+    if (b < 0) {
+        ub = -ub;
+        negative = !negative;
+    }
+    limit = negative ? 0x80000000UL : 0x7FFFFFFFUL;
+
+    result = fixed_umul16((uint16_t)(ua >> 16), (uint16_t)(ub >> 16));
+    if (result > 0x7FFF) {
+        goto saturate;
+    }
+    result <<= 16;
+
+    part = fixed_umul16((uint16_t)(ua >> 16), (uint16_t)ub);
+    result += part;
+    if (result < part) {
+        goto saturate;
+    }
+    part = fixed_umul16((uint16_t)ua, (uint16_t)(ub >> 16));
+    result += part;
+    if (result < part) {
+        goto saturate;
+    }
+    part = (fixed_umul16((uint16_t)ua, (uint16_t)ub) + 0x8000) >> 16;
+    result += part;
+    if (result < part || result > limit) {
+        goto saturate;
+    }
+
+    return (q16_16_t)(negative ? -result : result);
+
+saturate:
+    return negative ? Q16_16_MIN : Q16_16_MAX;
+}
@@ -0,0 +1,41 @@
+#include "fixed_private.h"
+
+q16_16_t q16Div(q16_16_t a, q16_16_t b)
+{
+    bool negative = false;
+    uint32_t ua = (uint32_t)a;
+    uint32_t ub = (uint32_t)b;
+    uint32_t quotient;
+    uint32_t remainder;
+    uint8_t i;
+
+    if (a < 0) {
+        ua = -ua;
+        negative = true;
+    }
+    if (b < 0) {
+        ub = -ub;
+        negative = !negative;
+    }
+    if (ub == 0 || ua / ub > 0x8000) {
+        return negative ? Q16_16_MIN : Q16_16_MAX;
+    }
+
+    // Integer part, then 16 fraction bits by shift and subtract. The
+    // remainder stays below ub <= 2^31, so the shift cannot overflow.
+    quotient = ua / ub;
+    remainder = ua % ub;
+    for (i = 0; i < 16; i++) {
+        quotient <<= 1;
+        remainder <<= 1;
+        if (remainder >= ub) {
+            remainder -= ub;
+            quotient |= 1;
+        }
+    }
+
+    if (quotient > (negative ? 0x80000000UL : 0x7FFFFFFFUL)) {
+        return negative ? Q16_16_MIN : Q16_16_MAX;
+    }
+    return (q16_16_t)(negative ? -quotient : quotient);
+}
@@ -0,0 +1,51 @@
+#include "fixed_private.h"
+
+// Digit-by-digit square root, two bits per step. sqrt(a) in Q16.16 is
+// the integer square root of a << 16; the second pass produces the low
+// 8 result bits after moving the remainder up by 16 bits.
+q16_16_t q16Sqrt(q16_16_t a)
+{
+    uint32_t num = (uint32_t)a;
+    uint32_t result = 0;
+    uint32_t bit = 0x40000000UL;
+    uint8_t pass;
+
+    if (a <= 0) {
+        return 0;
+    }
+    while (bit > num) {
+        bit >>= 2;
+    }
+
+    for (pass = 0; pass < 2; pass++) {
+        while (bit) {
+            if (num >= result + bit) {
+                num -= result + bit;
+                result = (result >> 1) + bit;
+            } else {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+
+        if (pass == 0) {
+            if (num > 0xFFFF) {
+                // The remainder would not fit after the shift: fold in
+                // half of the next bit first
+                num -= result;
+                num = (num << 16) - 0x8000;
+                result = (result << 16) + 0x8000;
+            } else {
+                num <<= 16;
+                result <<= 16;
+            }
+            bit = 1UL << 14;
+        }
+    }
+
+    // Round to nearest
+    if (num > result) {
+        result++;
+    }
+    return (q16_16_t)result;
+}
@@ -0,0 +1,43 @@
+#include "fixed_private.h"
+
+q8_8_t q8AddSat(q8_8_t a, q8_8_t b)
+{
+    return fixed_sat16((int32_t)a + b);
+}
+
+q8_8_t q8SubSat(q8_8_t a, q8_8_t b)
+{
+    return fixed_sat16((int32_t)a - b);
+}
+
+q8_8_t q8Mul(q8_8_t a, q8_8_t b)
+{
+    bool negative = false;
+    uint16_t ua = (uint16_t)a;
+    uint16_t ub = (uint16_t)b;
+    int32_t product;
+
+    if (a < 0) {
+        ua = -ua;
+        negative = true;
+    }
+    if (b < 0) {
+        ub = -ub;
+        negative = !negative;
+    }
+
+    // Round the magnitude, so the result is symmetric around zero
+    product = (int32_t)((fixed_umul16(ua, ub) + 0x80) >> 8);
+    return fixed_sat16(negative ? -product : product);
+}
+
+q8_8_t q16ToQ8(q16_16_t q)
+{
+    if (q > 0x007FFF7FL) {
+        return Q8_8_MAX;
+    }
+    if (q < -0x00800000L) {
+        return Q8_8_MIN;
+    }
+    return (q8_8_t)((q + 0x80) >> 8);
+}
@@ -0,0 +1,9 @@
+#include "fixed_private.h"
+
+q8_8_t q8Div(q8_8_t a, q8_8_t b)
+{
+    if (b == 0) {
+        return a < 0 ? Q8_8_MIN : Q8_8_MAX;
+    }
+    return fixed_sat16((int32_t)a * 256 / b);
+}
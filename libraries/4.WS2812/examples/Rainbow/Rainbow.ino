@@ -0,0 +1,47 @@
+/*
+  Rainbow
+  Runs a colour wheel along a strip of 8 WS2812 LEDs on P3.3 at a
+  quarter of full brightness.
+
+  This example code is in the public domain.
+*/
+
+#include "ws2812.h"
+
+#define LED_COUNT 8
+
+__xdata uint8_t leds[WS2812_BYTES(LED_COUNT)];
+
+// Colour wheel: red -> green -> blue -> red over 0..255
+static void wheel(uint8_t index, uint8_t pos) {
+  uint8_t step;
+
+  if (pos < 85) {
+    step = pos * 3;
+    ws2812SetPixel(index, 255 - step, step, 0);
+  } else if (pos < 170) {
+    step = (pos - 85) * 3;
+    ws2812SetPixel(index, 0, 255 - step, step);
+  } else {
+    step = (pos - 170) * 3;
+    ws2812SetPixel(index, step, 0, 255 - step);
+  }
+}
+
+void setup() {
+  ws2812Begin(P3_3, leds, LED_COUNT);
+  ws2812SetBrightness(64);
+}
+
+void loop() {
+  static uint8_t offset = 0;
+  uint8_t i;
+
+  for (i = 0; i < LED_COUNT; i++) {
+    wheel(i, offset + i * (256 / LED_COUNT));
+  }
+  ws2812Show();
+
+  offset++;
+  delay_ms(20);
+}
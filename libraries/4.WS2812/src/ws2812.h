@@ -0,0 +1,82 @@
+#ifndef WS2812_H
+#define WS2812_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// WS2812 / WS2812B / SK6812 (RGB) addressable LEDs on one pin.
+//
+//   __xdata uint8_t leds[WS2812_BYTES(8)];
+//   ws2812Begin(P3_3, leds, 8);
+//   ws2812SetPixel(0, 255, 0, 0);
+//   ws2812Show();
+//
+// The frame buffer belongs to the sketch and lives in XRAM, in the GRB
+// order the LEDs expect. ws2812Show() sends it with a bit loop in inline
+// assembly whose padding is generated for each Clock Speed menu entry
+// (ws2812_timing.h). Brightness and gamma are applied per byte while
+// sending, so the buffer keeps the full-scale colours.
+//
+// Interrupts are off while a frame is sent: 30 us per LED. The tick
+// timer latches one missed overflow, so frames longer than 1 ms (about
+// 33 LEDs) make millis() fall behind.
+
+#define WS2812_BYTES(count) ((count) * 3)
+
+// Line low time that latches a frame (WS2812B needs 280 us)
+#define WS2812_LATCH_US 300
+
+// Bit loop for one pin, selected at compile time (ws2812Begin)
+typedef void (*Ws2812Send_t)(void);
+
+void ws2812_begin(__xdata uint8_t *pixels, uint8_t count, Ws2812Send_t send);
+void ws2812_send_0(void);
+void ws2812_send_1(void);
+void ws2812_send_2(void);
+void ws2812_send_3(void);
+void ws2812_send_4(void);
+void ws2812_send_5(void);
+
+#define WS2812_CAT(a, b) WS2812_CAT_(a, b)
+#define WS2812_CAT_(a, b) a##b
+
+/**
+ * @brief Attach a strip and clear its buffer
+ * @param pin P3_0 .. P5_5 as a constant; only its bit loop is linked
+ * @param pixels Frame buffer of WS2812_BYTES(count) bytes
+ * @param count Number of LEDs
+ */
+#define ws2812Begin(pin, pixels, count) do { \
+    pinMode(pin, OUTPUT); \
+    digitalWrite(pin, LOW); \
+    ws2812_begin(pixels, count, WS2812_CAT(ws2812_send_, pin)); \
+} while(0)
+
+void ws2812SetPixel(uint8_t index, uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief Set every LED to the same colour
+ */
+void ws2812Fill(uint8_t r, uint8_t g, uint8_t b);
+
+/**
+ * @brief Scale the output, 255 = full (default)
+ */
+void ws2812SetBrightness(uint8_t level);
+
+/**
+ * @brief Square the output levels (gamma 2) so fades look even; on by default
+ */
+void ws2812SetGamma(bool enable);
+
+/**
+ * @brief Send the frame buffer
+ * @return false before ws2812Begin() or when the system clock is not
+ *         F_CPU (setClockDivider() breaks the bit timing)
+ *
+ * Waits first until the previous frame has latched.
+ */
+bool ws2812Show(void);
+
+#endif // WS2812_H
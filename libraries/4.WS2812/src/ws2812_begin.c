@@ -0,0 +1,28 @@
+#include "ws2812_private.h"
+
+__xdata uint8_t * __data ws2812_data = 0;
+__data uint8_t ws2812_count_lo = 0;
+__data uint8_t ws2812_count_hi = 0;
+__data uint8_t ws2812_scale = 255;
+__data uint8_t ws2812_fill = 0x00;
+
+MEM_WARM uint8_t ws2812_leds = 0;
+MEM_WARM Ws2812Send_t ws2812_send = 0;
+
+void ws2812_begin(__xdata uint8_t *pixels, uint8_t count, Ws2812Send_t send)
+{
+    uint16_t bytes = WS2812_BYTES((uint16_t)count);
+    uint16_t i;
+
+    for (i = 0; i < bytes; i++) {
+        pixels[i] = 0;
+    }
+
+    ws2812_data = pixels;
+    ws2812_leds = count;
+    ws2812_send = count ? send : 0;
+
+    // DJNZ r5 runs the low byte first (0 = 256), then r6 more passes of 256
+    ws2812_count_lo = LOW_BYTE(bytes);
+    ws2812_count_hi = HIGH_BYTE(bytes) + (ws2812_count_lo ? 1 : 0);
+}
@@ -0,0 +1,11 @@
+#include "ws2812_private.h"
+
+void ws2812SetBrightness(uint8_t level)
+{
+    ws2812_scale = level;
+}
+
+void ws2812SetGamma(bool enable)
+{
+    ws2812_fill = enable ? 0x00 : 0xFF;
+}
@@ -0,0 +1,13 @@
+#include "ws2812_private.h"
+
+void ws2812Fill(uint8_t r, uint8_t g, uint8_t b)
+{
+    __xdata uint8_t *p = ws2812_data;
+    uint8_t i;
+
+    for (i = 0; i < ws2812_leds; i++) {
+        *p++ = g;
+        *p++ = r;
+        *p++ = b;
+    }
+}
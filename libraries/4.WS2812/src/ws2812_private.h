@@ -0,0 +1,74 @@
+#ifndef WS2812_PRIVATE_H
+#define WS2812_PRIVATE_H
+
+#include "ws2812.h"
+#include "ws2812_timing.h"
+
+// Frame state read by the bit loop. The assembly addresses it directly,
+// so it stays in __data whatever the memory profile.
+extern __xdata uint8_t * __data ws2812_data;
+extern __data uint8_t ws2812_count_lo;  // Byte count for two DJNZ loops
+extern __data uint8_t ws2812_count_hi;
+extern __data uint8_t ws2812_scale;     // Brightness
+extern __data uint8_t ws2812_fill;      // 0x00 with gamma, 0xFF without
+
+// Set by ws2812_begin()
+extern MEM_WARM uint8_t ws2812_leds;
+extern MEM_WARM Ws2812Send_t ws2812_send;
+
+#define WS2812_STR(x) WS2812_STR_(x)
+#define WS2812_STR_(x) #x
+
+#if defined(__SDCC)
+
+// Send ws2812_count bytes from ws2812_data on the pin at bit address
+// bit, e.g. 0xB3 for P3.3. Each byte is scaled in the low time before
+// its first bit:
+//   v = (v * scale + v) >> 8           brightness, 255 keeps v
+//   v = (v * (v | fill) + v) >> 8      gamma 2, or v again when fill = 0xFF
+// The bit loop then shifts v out MSB first through C.
+#define WS2812_SEND(bit) __asm__( \
+    "mov dpl,_ws2812_data\n" \
+    "mov dph,(_ws2812_data + 1)\n" \
+    "mov r5,_ws2812_count_lo\n" \
+    "mov r6,_ws2812_count_hi\n" \
+    "00001$:\n" \
+    "movx a,@dptr\n" \
+    "inc dptr\n" \
+    "mov r4,a\n" \
+    "mov b,_ws2812_scale\n" \
+    "mul ab\n" \
+    "add a,r4\n" \
+    "clr a\n" \
+    "addc a,b\n" \
+    "mov r4,a\n" \
+    "orl a,_ws2812_fill\n" \
+    "mov b,a\n" \
+    "mov a,r4\n" \
+    "mul ab\n" \
+    "add a,r4\n" \
+    "clr a\n" \
+    "addc a,b\n" \
+    "rlc a\n" \
+    "mov r7,#8\n" \
+    "00002$:\n" \
+    "setb " WS2812_STR(bit) "\n" \
+    WS2812_PAD_T0H \
+    "mov " WS2812_STR(bit) ",c\n" \
+    WS2812_PAD_T1H \
+    "clr " WS2812_STR(bit) "\n" \
+    WS2812_PAD_LOW \
+    "rlc a\n" \
+    "djnz r7,00002$\n" \
+    "djnz r5,00001$\n" \
+    "djnz r6,00001$\n")
+
+#else
+
+// Host builds: same byte transform, no timing
+void ws2812_send_host(uint8_t bit);
+#define WS2812_SEND(bit) ws2812_send_host(bit)
+
+#endif
+
+#endif // WS2812_PRIVATE_H
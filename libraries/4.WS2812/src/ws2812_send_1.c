@@ -0,0 +1,7 @@
+#include "ws2812_private.h"
+
+// Bit loop for P3.1
+void ws2812_send_1(void)
+{
+    WS2812_SEND(0xB1);
+}
@@ -0,0 +1,7 @@
+#include "ws2812_private.h"
+
+// Bit loop for P3.2
+void ws2812_send_2(void)
+{
+    WS2812_SEND(0xB2);
+}
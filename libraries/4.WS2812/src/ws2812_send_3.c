@@ -0,0 +1,7 @@
+#include "ws2812_private.h"
+
+// Bit loop for P3.3
+void ws2812_send_3(void)
+{
+    WS2812_SEND(0xB3);
+}
@@ -0,0 +1,7 @@
+#include "ws2812_private.h"
+
+// Bit loop for P5.4
+void ws2812_send_4(void)
+{
+    WS2812_SEND(0xCC);
+}
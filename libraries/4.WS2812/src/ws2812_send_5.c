@@ -0,0 +1,7 @@
+#include "ws2812_private.h"
+
+// Bit loop for P5.5
+void ws2812_send_5(void)
+{
+    WS2812_SEND(0xCD);
+}
@@ -0,0 +1,37 @@
+#include "ws2812_private.h"
+
+// Host builds (tools/host): the byte transform of WS2812_SEND() in C,
+// bits written to the port without timing
+#if !defined(__SDCC)
+
+static void ws2812_host_level(uint8_t bit, uint8_t high)
+{
+    uint8_t mask = (uint8_t)(1 << (bit & 7));
+
+    if ((bit & 0xF8) == 0xC8) {
+        if (high) P5 |= mask; else P5 &= ~mask;
+    } else {
+        if (high) P3 |= mask; else P3 &= ~mask;
+    }
+}
+
+void ws2812_send_host(uint8_t bit)
+{
+    uint16_t bytes = WS2812_BYTES((uint16_t)ws2812_leds);
+    uint16_t i;
+    uint8_t v, n;
+
+    for (i = 0; i < bytes; i++) {
+        v = ws2812_data[i];
+        v = (uint8_t)(((uint16_t)v * ws2812_scale + v) >> 8);
+        v = (uint8_t)(((uint16_t)v * (v | ws2812_fill) + v) >> 8);
+        for (n = 0; n < 8; n++) {
+            ws2812_host_level(bit, 1);
+            ws2812_host_level(bit, v & 0x80);
+            ws2812_host_level(bit, 0);
+            v <<= 1;
+        }
+    }
+}
+
+#endif
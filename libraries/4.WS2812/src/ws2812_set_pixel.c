@@ -0,0 +1,16 @@
+#include "ws2812_private.h"
+
+void ws2812SetPixel(uint8_t index, uint8_t r, uint8_t g, uint8_t b)
+{
+    __xdata uint8_t *p;
+
+    if (index >= ws2812_leds) {
+        return;
+    }
+
+    // The LEDs shift in green first
+    p = ws2812_data + WS2812_BYTES((uint16_t)index);
+    p[0] = g;
+    p[1] = r;
+    p[2] = b;
+}
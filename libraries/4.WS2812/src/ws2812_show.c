@@ -0,0 +1,28 @@
+#include "ws2812_private.h"
+
+static MEM_WARM uint32_t ws2812_last_us = 0;
+
+bool ws2812Show(void)
+{
+    uint32_t elapsed;
+    bool ea;
+
+    if (!ws2812_send || getSystemClock() != F_CPU) {
+        return false;
+    }
+
+    // Keep the line low until the previous frame has latched
+    elapsed = micros() - ws2812_last_us;
+    if (elapsed < WS2812_LATCH_US) {
+        delay_us(WS2812_LATCH_US - (uint16_t)elapsed);
+    }
+
+    // A tick or UART interrupt inside a bit would stretch it into a 1
+    ea = IS_BIT_SET(IE, 7);
+    CLEAR_BIT(IE, 7);
+    ws2812_send();
+    if (ea) SET_BIT(IE, 7);
+
+    ws2812_last_us = micros();
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef WS2812_TIMING_H
+#define WS2812_TIMING_H
+
+// Generated by tools/ws2812-timing.py from the Clock Speed menu in
+// boards.txt. Do not edit; change the script and run it again.
+//
+//   F_CPU       T0H ns  T1H ns  bit ns
+//   11059200       362     723    1266
+//   12000000       333     750    1250
+//   16000000       375     750    1250
+//   20000000       350     750    1250
+//   22118400       362     769    1266
+//   24000000       333     750    1250
+//   30000000       367     767    1267
+//   33177600       362     754    1236
+
+#if F_CPU == 11059200L
+#define WS2812_PAD_T0H "nop\nnop\nnop\n"
+#define WS2812_PAD_T1H "nop\nnop\nnop\n"
+#define WS2812_PAD_LOW "nop\n"
+#elif F_CPU == 12000000L
+#define WS2812_PAD_T0H "nop\nnop\nnop\n"
+#define WS2812_PAD_T1H "nop\nnop\nnop\nnop\n"
+#define WS2812_PAD_LOW "nop\n"
+#elif F_CPU == 16000000L
+#define WS2812_PAD_T0H "nop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_T1H "nop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_LOW "nop\nnop\nnop\n"
+#elif F_CPU == 20000000L
+#define WS2812_PAD_T0H "nop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_T1H "nop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_LOW "nop\nnop\nnop\nnop\nnop\n"
+#elif F_CPU == 22118400L
+#define WS2812_PAD_T0H "nop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_T1H "nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_LOW "nop\nnop\nnop\nnop\nnop\nnop\n"
+#elif F_CPU == 24000000L
+#define WS2812_PAD_T0H "nop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_T1H "nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_LOW "nop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#elif F_CPU == 30000000L
+#define WS2812_PAD_T0H "nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_T1H "nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_LOW "nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#elif F_CPU == 33177600L
+#define WS2812_PAD_T0H "nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_T1H "nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#define WS2812_PAD_LOW "nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
+#else
+#error "WS2812: no bit timing for this F_CPU, run tools/ws2812-timing.py"
+#endif
+
+#endif // WS2812_TIMING_H
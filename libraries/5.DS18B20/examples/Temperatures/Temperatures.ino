@@ -0,0 +1,58 @@
+/*
+  Temperatures
+  Finds up to 4 DS18B20 sensors on P3.3 and prints their temperatures
+  every second. The conversion runs in a protothread, so loop() stays
+  free while the sensors convert.
+
+  Wiring: DQ to P3.3 with a 4.7k pull-up to VCC, sensors powered from VCC.
+
+  This example code is in the public domain.
+*/
+
+#include "pt.h"
+#include "ds18b20.h"
+
+#define BUS_PIN P3_3
+#define MAX_SENSORS 4
+
+static uint8_t roms[MAX_SENSORS][ONEWIRE_ROM_SIZE];
+static uint8_t sensors;
+static uint8_t current;
+static Pt_t measure;
+
+PT_THREAD(measureThread(Pt_t *pt)) {
+  int16_t raw;
+
+  PT_BEGIN(pt);
+  while (1) {
+    if (!ds18b20StartAll()) {
+      serialPrintln("No sensor");
+      WAIT_MS(pt, 1000);
+      continue;
+    }
+    WAIT_UNTIL(pt, ds18b20Ready());
+
+    for (current = 0; current < sensors; current++) {
+      if (ds18b20Read(roms[current], &raw)) {
+        serialPrintf("%u: %.2f C\r\n", current, ds18b20ToCentiC(raw));
+      } else {
+        serialPrintf("%u: CRC error\r\n", current);
+      }
+    }
+    WAIT_MS(pt, 1000);
+  }
+  PT_END(pt);
+}
+
+void setup() {
+  serialBegin(115200);
+  oneWireBegin(BUS_PIN);
+
+  sensors = ds18b20Find(roms, MAX_SENSORS);
+  serialPrintf("%u sensors\r\n", sensors);
+  PT_INIT(&measure);
+}
+
+void loop() {
+  measureThread(&measure);
+}
@@ -0,0 +1,71 @@
+#ifndef DS18B20_H
+#define DS18B20_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// DS18B20 temperature sensors on the 1-Wire bus (onewire.h). Call
+// oneWireBegin(pin) first.
+//
+// A conversion takes up to 750 ms. ds18b20StartAll() starts it on every
+// sensor at once and returns; poll ds18b20Ready() from loop() or a
+// protothread, then read each sensor:
+//
+//   ds18b20StartAll();
+//   WAIT_UNTIL(pt, ds18b20Ready());
+//   if (ds18b20Read(rom, &raw)) { ... }
+//
+// Temperatures are raw sensor values in 1/16 degree C.
+
+#define DS18B20_FAMILY 0x28
+
+// Function commands
+#define DS18B20_CONVERT_T        0x44
+#define DS18B20_READ_SCRATCHPAD  0xBE
+#define DS18B20_WRITE_SCRATCHPAD 0x4E
+
+#define DS18B20_SCRATCHPAD_SIZE 9
+
+// Raw reading to hundredths of a degree, e.g. print with "%.2f C"
+#define ds18b20ToCentiC(raw) ((int16_t)(((int32_t)(raw) * 25) / 4))
+
+/**
+ * @brief Search the bus for DS18B20 sensors
+ * @param roms Receives up to max ROM codes
+ * @return Number of sensors found
+ */
+uint8_t ds18b20Find(uint8_t roms[][ONEWIRE_ROM_SIZE], uint8_t max);
+
+/**
+ * @brief Set the resolution, 9..12 bits (12 after power-up)
+ * @param rom Sensor, or 0 for every sensor on the bus
+ * @return false if no sensor answered or bits is out of range
+ *
+ * Conversion time halves with each bit less: 750, 375, 188, 94 ms.
+ */
+bool ds18b20SetResolution(const uint8_t *rom, uint8_t bits);
+
+/**
+ * @brief Start a conversion on every sensor (Skip ROM, Convert T)
+ * @return false if no sensor answered the reset
+ */
+bool ds18b20StartAll(void);
+
+/**
+ * @brief true once the conversion started by ds18b20StartAll() is done
+ *
+ * Reads one time slot: sensors hold the bus low while converting.
+ * Also true after the conversion time of the current resolution.
+ */
+bool ds18b20Ready(void);
+
+/**
+ * @brief Read the last conversion result
+ * @param rom Sensor, or 0 when it is the only device on the bus
+ * @param raw Receives the temperature in 1/16 degree C
+ * @return false if no sensor answered or the scratchpad failed its CRC8
+ */
+bool ds18b20Read(const uint8_t *rom, int16_t *raw);
+
+#endif // DS18B20_H
@@ -0,0 +1,31 @@
+#include "ds18b20_private.h"
+
+MEM_WARM uint16_t ds18b20_conv_ms = 751;  // 12 bits
+static MEM_WARM bool ds18b20_converting = false;
+static MEM_WARM uint32_t ds18b20_start_ms = 0;
+
+bool ds18b20StartAll(void)
+{
+    if (!oneWireReset()) {
+        return false;
+    }
+    oneWireSelect(0);
+    oneWireWrite(DS18B20_CONVERT_T);
+
+    ds18b20_start_ms = millis();
+    ds18b20_converting = true;
+    return true;
+}
+
+bool ds18b20Ready(void)
+{
+    if (!ds18b20_converting) {
+        return true;
+    }
+
+    // A read slot returns 1 once every sensor has finished
+    if (oneWireReadBit() || millis() - ds18b20_start_ms >= ds18b20_conv_ms) {
+        ds18b20_converting = false;
+    }
+    return !ds18b20_converting;
+}
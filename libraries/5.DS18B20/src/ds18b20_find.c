@@ -0,0 +1,15 @@
+#include "ds18b20_private.h"
+
+uint8_t ds18b20Find(uint8_t roms[][ONEWIRE_ROM_SIZE], uint8_t max)
+{
+    uint8_t count = 0;
+
+    oneWireResetSearch();
+    while (count < max && oneWireSearch(roms[count])) {
+        // Other 1-Wire parts may share the bus
+        if (roms[count][0] == DS18B20_FAMILY) {
+            count++;
+        }
+    }
+    return count;
+}
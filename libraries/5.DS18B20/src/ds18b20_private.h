@@ -0,0 +1,15 @@
+#ifndef DS18B20_PRIVATE_H
+#define DS18B20_PRIVATE_H
+
+#include "ds18b20.h"
+
+// Conversion time of the current resolution (ds18b20_convert.c)
+extern MEM_WARM uint16_t ds18b20_conv_ms;
+
+/**
+ * @brief Reset, address rom and read the scratchpad
+ * @return false without a presence pulse or on a CRC8 mismatch
+ */
+bool ds18b20_read_scratchpad(const uint8_t *rom, uint8_t *pad);
+
+#endif // DS18B20_PRIVATE_H
@@ -0,0 +1,30 @@
+#include "ds18b20_private.h"
+
+bool ds18b20_read_scratchpad(const uint8_t *rom, uint8_t *pad)
+{
+    uint8_t i;
+
+    if (!oneWireReset()) {
+        return false;
+    }
+    oneWireSelect(rom);
+    oneWireWrite(DS18B20_READ_SCRATCHPAD);
+    for (i = 0; i < DS18B20_SCRATCHPAD_SIZE; i++) {
+        pad[i] = oneWireRead();
+    }
+
+    // Bits 4..0 of the configuration byte always read 1, which rules
+    // out a bus held low (all zeros, CRC 0)
+    return crc8(CRC8_INIT, pad, DS18B20_SCRATCHPAD_SIZE) == 0 && (pad[4] & 0x1F) == 0x1F;
+}
+
+bool ds18b20Read(const uint8_t *rom, int16_t *raw)
+{
+    uint8_t pad[DS18B20_SCRATCHPAD_SIZE];
+
+    if (!ds18b20_read_scratchpad(rom, pad)) {
+        return false;
+    }
+    *raw = (int16_t)(((uint16_t)pad[1] << 8) | pad[0]);
+    return true;
+}
@@ -0,0 +1,33 @@
+#include "ds18b20_private.h"
+
+bool ds18b20SetResolution(const uint8_t *rom, uint8_t bits)
+{
+    uint8_t pad[DS18B20_SCRATCHPAD_SIZE];
+
+    if (bits < 9 || bits > 12) {
+        return false;
+    }
+
+    // Keep the alarm limits of one sensor; for all of them use the
+    // factory values (75 and 70 C)
+    if (rom) {
+        if (!ds18b20_read_scratchpad(rom, pad)) {
+            return false;
+        }
+    } else {
+        pad[2] = 75;
+        pad[3] = 70;
+    }
+
+    if (!oneWireReset()) {
+        return false;
+    }
+    oneWireSelect(rom);
+    oneWireWrite(DS18B20_WRITE_SCRATCHPAD);
+    oneWireWrite(pad[2]);                           // TH
+    oneWireWrite(pad[3]);                           // TL
+    oneWireWrite(((bits - 9) << 5) | 0x1F);         // Configuration
+
+    ds18b20_conv_ms = (750 >> (12 - bits)) + 1;
+    return true;
+}
@@ -0,0 +1,110 @@
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Simulated SFRs and peripherals for host builds of the core and drivers
+// (see cores/stc8/compiler.h). The registers are plain globals; the model
+// only runs when the code under test calls HW_WAIT() from a busy-wait
+// loop or the test calls one of the functions below. ISRs are called
+// directly when their enable bits and EA are set, otherwise on the next
+// model call after they are enabled.
+
+// Size of the captured UART output
+#ifndef HOST_UART_OUTPUT_SIZE
+#define HOST_UART_OUTPUT_SIZE 1024
+#endif
+
+// Timer0 counts added by each HW_WAIT() on the tick counter (delay())
+#ifndef HOST_TIMER0_WAIT_STEP
+#define HOST_TIMER0_WAIT_STEP 100
+#endif
+
+/**
+ * @brief Reset all SFRs to 0 and clear the peripheral model
+ *
+ * Driver state (ring indices, timer_initialized, ...) is not reset.
+ */
+void host_reset(void);
+
+/**
+ * @brief Receive one byte on UART1
+ *
+ * Loads SBUF, sets RI and runs uart1_isr() if ES and EA are set. A byte
+ * that arrives while RI is still set overwrites the previous one, as on
+ * the chip.
+ */
+void host_uart_receive(uint8_t byte);
+
+/**
+ * @brief Receive a NUL-terminated string on UART1
+ */
+void host_uart_receive_string(const char *str);
+
+/**
+ * @brief Bytes sent on UART1 since the last host_uart_clear_output()
+ * @param len Set to the number of bytes (may be NULL)
+ * @return NUL-terminated copy of the output
+ */
+const char *host_uart_output(uint16_t *len);
+
+/**
+ * @brief Discard the captured UART output
+ */
+void host_uart_clear_output(void);
+
+/**
+ * @brief Advance Timer0 by a number of timer clocks
+ *
+ * Timer0 runs in mode 0 (16-bit auto-reload) while TR0 is set. The reload
+ * value is latched from TH0:TL0 when the model first sees the timer
+ * running. Each overflow sets TF0 and runs timer0_isr() if ET0 and EA
+ * are set.
+ */
+void host_timer0_advance(uint32_t clocks);
+
+/**
+ * @brief End the next power-down early, as an interrupt pin would
+ * @param counts Wake-up timer counts before the wake-up (0 = none)
+ *
+ * Only the counter read-back is modelled; no ISR runs and wakeup_irq
+ * is not set.
+ */
+void host_wkt_wake_after(uint16_t counts);
+
+/**
+ * @brief Wake-up timer counts spent in power-down since host_reset()
+ *
+ * A power-down with PCON.PD set runs the wake-up timer to its reload
+ * value (WKTCH:WKTCL + 1 counts) when WKTEN is set. Without WKTEN it
+ * returns at once, as if an interrupt had woken the chip.
+ */
+uint64_t host_wkt_counts(void);
+
+/**
+ * @brief Attach a register-file slave to the I2C bus
+ * @param address 7-bit address, or 0 to remove the slave
+ * @param regs    Register contents; the first byte of a write sets the
+ *                register pointer, later bytes are stored, reads return
+ *                bytes from the pointer on. The pointer wraps at size.
+ * @param size    Number of registers
+ *
+ * Transfers to any other address are NAKed.
+ */
+void host_i2c_slave(uint8_t address, uint8_t *regs, uint16_t size);
+
+/**
+ * @brief Number of I2C master commands executed since host_reset()
+ */
+uint32_t host_i2c_commands(void);
+
+/**
+ * @brief Run the model for a register polled in a busy-wait loop
+ *
+ * Called through HW_WAIT(). Tests of non-blocking drivers (wirePoll())
+ * can call it with the polled register to let the peripheral progress.
+ */
+void host_hw_wait(volatile uint8_t *reg);
+
+#endif // HOST_HAL_H
@@ -0,0 +1,326 @@
+#include <string.h>
+
+// Allocate the SFR globals declared by variant.h in this file
+#define HOST_SFR_STORAGE
+#include "Arduino.h"
+#include "host_hal.h"
+
+// ISRs of the modelled peripherals. Weak, so tests only link the drivers
+// they exercise.
+void uart1_isr(void) __attribute__((weak));
+void timer0_isr(void) __attribute__((weak));
+
+#define SCON_RI  0x01
+#define SCON_TI  0x02
+#define TCON_TR0 0x10
+#define TCON_TF0 0x20
+#define IE_ET0   0x02
+#define IE_ES    0x10
+#define IE_EA    0x80
+
+#define WKT_COUNT(h, l) (((uint16_t)((h) & WKTCH_MASK) << 8) | (l))
+
+static char uart_output[HOST_UART_OUTPUT_SIZE + 1];
+static uint16_t uart_output_len = 0;
+
+static bool timer0_latched = false;
+static uint16_t timer0_reload = 0;
+static uint16_t timer0_count = 0;  // TH0:TL0 as left by the model
+
+static uint64_t wkt_total = 0;       // Counts slept since host_reset()
+static uint16_t wkt_wake_after = 0;  // Early wake-up, 0 = none
+
+static uint8_t *i2c_regs = NULL;
+static uint16_t i2c_size = 0;
+static uint16_t i2c_pointer = 0;
+static uint8_t i2c_address = 0;
+static uint32_t i2c_command_count = 0;
+
+// Bus state between START and STOP
+static bool i2c_addressed = false;  // Address byte sent
+static bool i2c_selected = false;   // Address matched the slave
+static bool i2c_reading = false;
+static bool i2c_pointer_set = false;
+static bool i2c_last_ack = false;
+
+// Run pending interrupts whose enable bits are set
+static void host_dispatch(void)
+{
+    if (!(IE & IE_EA)) {
+        return;
+    }
+    if ((TCON & TCON_TF0) && (IE & IE_ET0) && timer0_isr) {
+        TCON &= ~TCON_TF0;  // Cleared by hardware on entry
+        timer0_isr();
+    }
+    if ((SCON & SCON_RI) && (IE & IE_ES) && uart1_isr) {
+        uart1_isr();
+    }
+}
+
+void host_reset(void)
+{
+    // Zero every SFR and XFR by symbol; the model only sees the C globals
+#define HOST_SFR_CLEAR(name) name = 0
+    HOST_SFR_CLEAR(P0); HOST_SFR_CLEAR(P1); HOST_SFR_CLEAR(P2);
+    HOST_SFR_CLEAR(P3); HOST_SFR_CLEAR(P5);
+    HOST_SFR_CLEAR(PCON); HOST_SFR_CLEAR(TCON); HOST_SFR_CLEAR(TMOD);
+    HOST_SFR_CLEAR(TL0); HOST_SFR_CLEAR(TH0); HOST_SFR_CLEAR(TL1);
+    HOST_SFR_CLEAR(TH1); HOST_SFR_CLEAR(T2L); HOST_SFR_CLEAR(T2H);
+    HOST_SFR_CLEAR(AUXR); HOST_SFR_CLEAR(AUXINTIF); HOST_SFR_CLEAR(INTCLKO);
+    HOST_SFR_CLEAR(SCON); HOST_SFR_CLEAR(SBUF);
+    HOST_SFR_CLEAR(IE); HOST_SFR_CLEAR(IE2); HOST_SFR_CLEAR(IP);
+    HOST_SFR_CLEAR(P_SW1); HOST_SFR_CLEAR(P_SW2);
+    HOST_SFR_CLEAR(I2CCFG); HOST_SFR_CLEAR(I2CMSCR); HOST_SFR_CLEAR(I2CMSST);
+    HOST_SFR_CLEAR(I2CTXD); HOST_SFR_CLEAR(I2CRXD); HOST_SFR_CLEAR(I2CMSAUX);
+    HOST_SFR_CLEAR(CLKDIV); HOST_SFR_CLEAR(CKSEL);
+    HOST_SFR_CLEAR(WKTCL); HOST_SFR_CLEAR(WKTCH);
+#undef HOST_SFR_CLEAR
+
+    host_uart_clear_output();
+    timer0_latched = false;
+    timer0_reload = 0;
+    timer0_count = 0;
+    wkt_total = 0;
+    wkt_wake_after = 0;
+    i2c_regs = NULL;
+    i2c_size = 0;
+    i2c_pointer = 0;
+    i2c_address = 0;
+    i2c_command_count = 0;
+    i2c_addressed = false;
+    i2c_selected = false;
+}
+
+// ====================================================================================
+// UART1
+// ====================================================================================
+
+void host_uart_receive(uint8_t byte)
+{
+    SBUF = byte;
+    SCON |= SCON_RI;
+    host_dispatch();
+}
+
+void host_uart_receive_string(const char *str)
+{
+    while (*str) {
+        host_uart_receive((uint8_t)*str++);
+    }
+}
+
+const char *host_uart_output(uint16_t *len)
+{
+    if (len) {
+        *len = uart_output_len;
+    }
+    uart_output[uart_output_len] = '\0';
+    return uart_output;
+}
+
+void host_uart_clear_output(void)
+{
+    uart_output_len = 0;
+}
+
+// serialWrite() waits for TI right after loading SBUF: send the byte
+static void uart_transmit(void)
+{
+    if (uart_output_len < HOST_UART_OUTPUT_SIZE) {
+        uart_output[uart_output_len++] = (char)SBUF;
+    }
+    SCON |= SCON_TI;
+}
+
+// ====================================================================================
+// Timer0
+// ====================================================================================
+
+void host_timer0_advance(uint32_t clocks)
+{
+    uint16_t count;
+
+    if (!(TCON & TCON_TR0)) {
+        // Writes while stopped go to the reload registers
+        timer0_latched = false;
+        return;
+    }
+    count = ((uint16_t)TH0 << 8) | TL0;
+    if (!timer0_latched || count != timer0_count) {
+        // First run, or the code wrote TH0:TL0 (a retime) since the
+        // last step; the count restarts from the new reload
+        timer0_reload = count;
+        timer0_latched = true;
+    }
+
+    while (clocks) {
+        uint32_t to_overflow = 0x10000UL - count;
+
+        if (clocks < to_overflow) {
+            count += (uint16_t)clocks;
+            break;
+        }
+        clocks -= to_overflow;
+        count = timer0_reload;
+        TH0 = (uint8_t)(count >> 8);
+        TL0 = (uint8_t)count;
+        TCON |= TCON_TF0;
+        host_dispatch();
+    }
+    TH0 = (uint8_t)(count >> 8);
+    TL0 = (uint8_t)count;
+    timer0_count = count;
+    host_dispatch();
+}
+
+// ====================================================================================
+// Power-down and wake-up timer
+// ====================================================================================
+
+void host_wkt_wake_after(uint16_t counts)
+{
+    wkt_wake_after = counts;
+}
+
+uint64_t host_wkt_counts(void)
+{
+    return wkt_total;
+}
+
+// PCON.PD was set: run the wake-up timer until it or an early wake-up
+// ends the power-down. The count registers then read the internal counter.
+static void power_down(void)
+{
+    uint16_t reload;
+    uint16_t counts;
+
+    if (!(PCON & PCON_PD)) {
+        return;
+    }
+    PCON &= ~PCON_PD;  // Cleared by hardware on wake-up
+
+    if (!(WKTCH & WKTCH_WKTEN)) {
+        wkt_wake_after = 0;  // Only an interrupt ends this power-down
+        return;
+    }
+
+    reload = WKT_COUNT(WKTCH, WKTCL);
+    counts = reload + 1;
+    if (wkt_wake_after && wkt_wake_after < counts) {
+        counts = wkt_wake_after;
+    }
+    wkt_wake_after = 0;
+    wkt_total += counts;
+
+    // The counter stops at the reload value when the timer ends the sleep
+    if (counts > reload) {
+        counts = reload;
+    }
+    WKTCL = (uint8_t)counts;
+    WKTCH = (uint8_t)(counts >> 8) | WKTCH_WKTEN;
+}
+
+// ====================================================================================
+// I2C master
+// ====================================================================================
+
+void host_i2c_slave(uint8_t address, uint8_t *regs, uint16_t size)
+{
+    i2c_address = address;
+    i2c_regs = regs;
+    i2c_size = size;
+    i2c_pointer = 0;
+}
+
+uint32_t host_i2c_commands(void)
+{
+    return i2c_command_count;
+}
+
+static void i2c_send(uint8_t data)
+{
+    if (!i2c_addressed) {
+        i2c_addressed = true;
+        i2c_selected = i2c_regs && i2c_size && (data >> 1) == i2c_address;
+        i2c_reading = data & 0x01;
+        i2c_pointer_set = false;
+        i2c_last_ack = i2c_selected;
+        return;
+    }
+
+    i2c_last_ack = i2c_selected && !i2c_reading;
+    if (!i2c_last_ack) {
+        return;
+    }
+    if (!i2c_pointer_set) {
+        i2c_pointer = data % i2c_size;
+        i2c_pointer_set = true;
+    } else {
+        i2c_regs[i2c_pointer] = data;
+        i2c_pointer = (i2c_pointer + 1) % i2c_size;
+    }
+}
+
+// Execute the command in I2CMSCR, then flag completion with MSIF
+static void i2c_command(void)
+{
+    uint8_t command = I2CMSCR & 0x0F;
+
+    if (command == I2C_CMD_IDLE || !(I2CCFG & I2C_ENI2C)) {
+        return;
+    }
+
+    switch (command) {
+        case I2C_CMD_START:
+            i2c_addressed = false;
+            i2c_selected = false;
+            break;
+        case I2C_CMD_SENDDATA:
+            i2c_send(I2CTXD);
+            break;
+        case I2C_CMD_RECVACK:
+            if (i2c_last_ack) {
+                I2CMSST &= ~I2C_MSACKI;
+            } else {
+                I2CMSST |= I2C_MSACKI;
+            }
+            break;
+        case I2C_CMD_RECVDATA:
+            if (i2c_selected && i2c_reading) {
+                I2CRXD = i2c_regs[i2c_pointer];
+                i2c_pointer = (i2c_pointer + 1) % i2c_size;
+            } else {
+                I2CRXD = 0xFF;  // Released bus
+            }
+            break;
+        case I2C_CMD_SENDACK:
+            break;
+        case I2C_CMD_STOP:
+            i2c_addressed = false;
+            i2c_selected = false;
+            break;
+    }
+
+    i2c_command_count++;
+    I2CMSCR &= ~0x0F;  // Command field returns to idle when done
+    I2CMSST |= I2C_MSIF;
+}
+
+// ====================================================================================
+// Busy-wait hook
+// ====================================================================================
+
+void host_hw_wait(volatile uint8_t *reg)
+{
+    if (reg == &SCON) {
+        uart_transmit();
+    } else if (reg == &I2CMSST) {
+        i2c_command();
+    } else if (reg == &TL0) {
+        host_timer0_advance(HOST_TIMER0_WAIT_STEP);
+    } else if (reg == &PCON) {
+        power_down();
+    }
+    host_dispatch();
+}
@@ -0,0 +1,95 @@
+#include <string.h>
+#include "Arduino.h"
+#include "iap_mock.h"
+
+// Emulated data flash with real NOR semantics: erase sets a sector to
+// 0xFF, programming can only clear bits.
+static uint8_t mock_flash[IAP_MOCK_SIZE];
+static uint32_t mock_erases[IAP_MOCK_SECTORS];
+static uint32_t mock_writes = 0;
+static uint32_t mock_violations = 0;
+static int32_t mock_budget = -1;  // Operations left before power loss
+
+// Count one operation against the power-loss budget
+static bool mock_powered(void) {
+    if (mock_budget < 0) {
+        return true;
+    }
+    if (mock_budget == 0) {
+        return false;
+    }
+    mock_budget--;
+    return true;
+}
+
+void iap_mock_reset(void) {
+    memset(mock_flash, 0xFF, sizeof(mock_flash));
+    memset(mock_erases, 0, sizeof(mock_erases));
+    mock_writes = 0;
+    mock_violations = 0;
+    mock_budget = -1;
+}
+
+void iap_mock_fail_after(int32_t n) {
+    mock_budget = n;
+}
+
+void iap_mock_power_on(void) {
+    mock_budget = -1;
+}
+
+uint32_t iap_mock_erase_count(uint16_t addr) {
+    if (addr >= IAP_MOCK_SIZE) {
+        return 0;
+    }
+    return mock_erases[addr / IAP_SECTOR_SIZE];
+}
+
+uint32_t iap_mock_write_count(void) {
+    return mock_writes;
+}
+
+uint32_t iap_mock_violations(void) {
+    return mock_violations;
+}
+
+uint8_t *iap_mock_memory(void) {
+    return mock_flash;
+}
+
+uint8_t iapReadByte(uint16_t addr) {
+    if (addr >= IAP_MOCK_SIZE) {
+        return 0xFF;
+    }
+    return mock_flash[addr];
+}
+
+bool iapWriteByte(uint16_t addr, uint8_t data) {
+    if (addr >= IAP_MOCK_SIZE) {
+        return false;
+    }
+    if (!mock_powered()) {
+        return true;  // The CPU never learns the write was lost
+    }
+    if (data & ~mock_flash[addr]) {
+        mock_violations++;
+    }
+    mock_flash[addr] &= data;
+    mock_writes++;
+    return true;
+}
+
+bool iapEraseSector(uint16_t addr) {
+    uint16_t sector;
+
+    if (addr >= IAP_MOCK_SIZE) {
+        return false;
+    }
+    if (!mock_powered()) {
+        return true;
+    }
+    sector = addr / IAP_SECTOR_SIZE;
+    memset(&mock_flash[sector * IAP_SECTOR_SIZE], 0xFF, IAP_SECTOR_SIZE);
+    mock_erases[sector]++;
+    return true;
+}
@@ -0,0 +1,44 @@
+#ifndef IAP_MOCK_H
+#define IAP_MOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Size of the emulated EEPROM area
+#ifndef IAP_MOCK_SIZE
+#define IAP_MOCK_SIZE 4096
+#endif
+
+#define IAP_MOCK_SECTORS (IAP_MOCK_SIZE / IAP_SECTOR_SIZE)
+
+/**
+ * @brief Erase the whole emulated area to 0xFF and reset the counters
+ */
+void iap_mock_reset(void);
+
+/**
+ * @brief Simulate a power loss after the next n byte writes/erases
+ *
+ * Operations after the n-th are silently dropped until
+ * iap_mock_power_on(). Pass -1 to disable.
+ */
+void iap_mock_fail_after(int32_t n);
+
+/**
+ * @brief Restore power; dropped operations stay lost
+ */
+void iap_mock_power_on(void);
+
+/** @brief Number of erases of the sector containing addr */
+uint32_t iap_mock_erase_count(uint16_t addr);
+
+/** @brief Total byte programs since the last reset */
+uint32_t iap_mock_write_count(void);
+
+/** @brief Programs that tried to turn a 0 bit back into 1 */
+uint32_t iap_mock_violations(void);
+
+/** @brief Direct access to the emulated flash contents */
+uint8_t *iap_mock_memory(void);
+
+#endif // IAP_MOCK_H
@@ -0,0 +1,73 @@
+#!/bin/bash
+# Build and run the host tests in tools/host/tests
+#
+# Usage: tools/host/run-tests.sh
+#
+# Each test is built with the native compiler and the sanitizers against
+# the real core and driver sources and the SFR model in host_sfr.c.
+#
+# Environment:
+#   CC      Compiler to use (default gcc)
+
+CC="${CC:-gcc}"
+ROOT="$(cd "$(dirname "$0")/../.." && pwd)"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+CORE="$ROOT/cores/stc8"
+DRV="$ROOT/variants/stc8g1k08a/drivers/src"
+HOST="$ROOT/tools/host"
+CFLAGS="-g -std=gnu11 -fsanitize=address,undefined -fno-sanitize-recover=all \
+    -DF_CPU=24000000UL -I$CORE -I$ROOT/variants/stc8g1k08a -I$HOST"
+
+# Sources every test that runs the tick needs
+TICK="$DRV/clock.c $DRV/timers.c $DRV/micro_millis.c $CORE/events.c $HOST/host_sfr.c"
+
+FAILED=0
+
+# run <name> <extra CFLAGS> <sources...>
+run() {
+    local name="$1"
+    local flags="$2"
+    shift 2
+
+    # shellcheck disable=SC2086
+    if ! $CC $CFLAGS $flags "$@" -o "$WORK/$name"; then
+        echo "FAIL $name (build)"
+        FAILED=1
+    elif ! "$WORK/$name"; then
+        echo "FAIL $name"
+        FAILED=1
+    else
+        echo "PASS $name"
+    fi
+}
+
+# millis() compensation after power-down, at the nominal and two
+# calibrated wake-up timer clocks
+for hz in 32000 31250 33170; do
+    run "sleep_accuracy_$hz" "-DSLEEP_WKT_HZ=${hz}UL" \
+        "$HOST/tests/sleep_accuracy.c" "$DRV/sleep.c" "$CORE/interrupt.c" $TICK
+done
+
+# delay_us() across setClockDivider()
+run delay_us "" "$HOST/tests/delay_us.c" $TICK
+
+# Key/value store on the IAP mock (in place of iap.c)
+for sectors in 2 4; do
+    run "eeprom_$sectors" "-DEEPROM_SECTORS=$sectors" \
+        "$HOST/tests/eeprom.c" "$DRV/eeprom.c" "$HOST/iap_mock.c"
+done
+
+# Serial line reader and number printer on the UART1 model
+SERIAL="$CORE/serial/*.c $CORE/interrupt.c"
+run serial_line "" "$HOST/tests/serial_line.c" $SERIAL $TICK
+run print_number "" "$HOST/tests/print_number.c" $SERIAL $TICK
+
+# Wire against the register-file slave
+run i2c_slave "" "$HOST/tests/i2c_slave.c" "$DRV"/i2c/*.c $TICK
+
+# CRC and checksum kernels against bitwise references
+run crc "" "$HOST/tests/crc.c" "$CORE"/crc/*.c
+
+exit $FAILED
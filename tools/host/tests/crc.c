@@ -0,0 +1,167 @@
+// CRC-8/16/32, checksum8 and Fletcher-16: the check values for
+// "123456789", then 2000 random buffers through every variant against
+// bitwise references, fed in two pieces to cover the running value.
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "crc.h"
+
+#define BUFFERS 2000
+#define MAX_LEN 300
+
+static const uint8_t check[] = "123456789";
+
+static uint32_t lcg = 1;
+
+static uint8_t random_byte(void)
+{
+    lcg = lcg * 1103515245UL + 12345UL;
+    return (uint8_t)(lcg >> 16);
+}
+
+// Bitwise references, straight from the polynomial definitions
+static uint8_t ref_crc8(uint8_t crc, const uint8_t *buf, uint16_t len)
+{
+    uint8_t bit;
+
+    while (len--) {
+        crc ^= *buf++;
+        for (bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0x8C : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static uint16_t ref_crc16(uint16_t crc, const uint8_t *buf, uint16_t len)
+{
+    uint8_t bit;
+
+    while (len--) {
+        crc ^= (uint16_t)*buf++ << 8;
+        for (bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)(crc << 1) ^ 0x1021 : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint32_t ref_crc32(uint32_t crc, const uint8_t *buf, uint16_t len)
+{
+    uint8_t bit;
+
+    while (len--) {
+        crc ^= *buf++;
+        for (bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320UL : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static uint16_t ref_fletcher16(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint16_t lo = sum & 0xFF;
+    uint16_t hi = sum >> 8;
+
+    while (len--) {
+        lo = (lo + *buf++) % 255;
+        hi = (hi + lo) % 255;
+    }
+    return (uint16_t)(hi << 8) | lo;
+}
+
+static void check_values(void)
+{
+    uint8_t c8 = CRC8_INIT;
+    uint16_t c16 = CRC16_INIT;
+    uint32_t c32 = CRC32_INIT;
+    uint8_t f8 = CRC8_INIT;
+    uint16_t f16 = CRC16_INIT;
+    uint32_t f32 = CRC32_INIT;
+    uint8_t i;
+
+    for (i = 0; i < 9; i++) {
+        c8 = crc8Update(c8, check[i]);
+        c16 = crc16Update(c16, check[i]);
+        c32 = crc32Update(c32, check[i]);
+        f8 = crc8UpdateFast(f8, check[i]);
+        f16 = crc16UpdateFast(f16, check[i]);
+        f32 = crc32UpdateFast(f32, check[i]);
+    }
+    assert(c8 == 0xA1 && f8 == 0xA1);
+    assert(c16 == 0x29B1 && f16 == 0x29B1);
+    assert(crc32Final(c32) == 0xCBF43926UL && crc32Final(f32) == 0xCBF43926UL);
+
+    assert(crc8(CRC8_INIT, check, 9) == 0xA1);
+    assert(crc16(CRC16_INIT, check, 9) == 0x29B1);
+    assert(crc16(0x0000, check, 9) == 0x31C3);  // XMODEM
+    assert(crc32Final(crc32(CRC32_INIT, check, 9)) == 0xCBF43926UL);
+
+    assert(fletcher16(0, (const uint8_t *)"abcde", 5) == 0xC8F0);
+    assert(fletcher16(0, (const uint8_t *)"abcdefgh", 8) == 0x0627);
+    assert(checksum8(0, check, 9) == (uint8_t)477);
+}
+
+static void check_buffers(void)
+{
+    static uint8_t buf[MAX_LEN];
+    uint16_t n;
+    uint16_t len;
+    uint16_t split;
+    uint16_t i;
+
+    for (n = 0; n < BUFFERS; n++) {
+        uint8_t c8 = random_byte();
+        uint16_t c16 = ((uint16_t)random_byte() << 8) | random_byte();
+        uint32_t c32 = ((uint32_t)c16 << 16) | random_byte();
+        uint16_t f = (uint16_t)(random_byte() % 255 << 8) | random_byte() % 255;
+        uint8_t u8 = c8;
+        uint16_t u16 = c16;
+        uint32_t u32 = c32;
+        uint8_t sum = 0;
+
+        len = (uint16_t)(((uint16_t)random_byte() << 8 | random_byte()) % (MAX_LEN + 1));
+        split = len ? random_byte() % (len + 1) : 0;
+        for (i = 0; i < len; i++) {
+            buf[i] = random_byte();
+            sum += buf[i];
+        }
+
+        assert(crc8(crc8(c8, buf, split), buf + split, len - split) ==
+               ref_crc8(c8, buf, len));
+        assert(crc16(crc16(c16, buf, split), buf + split, len - split) ==
+               ref_crc16(c16, buf, len));
+        assert(crc32(crc32(c32, buf, split), buf + split, len - split) ==
+               ref_crc32(c32, buf, len));
+        assert(crc8Xdata(c8, buf, len) == ref_crc8(c8, buf, len));
+        assert(crc16Xdata(c16, buf, len) == ref_crc16(c16, buf, len));
+        assert(crc32Xdata(c32, buf, len) == ref_crc32(c32, buf, len));
+
+        // The internal RAM kernels take up to 255 bytes
+        assert(crc8Data(c8, buf, (uint8_t)split) == ref_crc8(c8, buf, (uint8_t)split));
+        assert(crc16Data(c16, buf, (uint8_t)split) == ref_crc16(c16, buf, (uint8_t)split));
+        assert(crc32Data(c32, buf, (uint8_t)split) == ref_crc32(c32, buf, (uint8_t)split));
+
+        for (i = 0; i < len; i++) {
+            u8 = (i & 1) ? crc8Update(u8, buf[i]) : crc8UpdateFast(u8, buf[i]);
+            u16 = (i & 1) ? crc16Update(u16, buf[i]) : crc16UpdateFast(u16, buf[i]);
+            u32 = (i & 1) ? crc32Update(u32, buf[i]) : crc32UpdateFast(u32, buf[i]);
+        }
+        assert(u8 == ref_crc8(c8, buf, len));
+        assert(u16 == ref_crc16(c16, buf, len));
+        assert(u32 == ref_crc32(c32, buf, len));
+
+        assert(fletcher16(fletcher16(f, buf, split), buf + split, len - split) ==
+               ref_fletcher16(f, buf, len));
+        assert(checksum8(0, buf, len) == sum);
+    }
+}
+
+int main(void)
+{
+    check_values();
+    check_buffers();
+    printf("crc: %d buffers OK\n", BUFFERS);
+    return 0;
+}
@@ -0,0 +1,70 @@
+// delay_us() at the full clock and after setClockDivider() down to
+// 500 kHz: never shorter than requested, and no longer than the model's
+// polling step allows. Also checks the 65536 us blocks of long delays,
+// and delay_cycles_since() across the tick reload.
+#include <assert.h>
+#include <stdio.h>
+#include "Arduino.h"
+#include "host_hal.h"
+
+void setup(void) {}
+void loop(void) {}
+
+static void check(uint32_t us)
+{
+    uint32_t start = micros();
+    uint32_t elapsed;
+    uint32_t slack = 2 * HOST_TIMER0_WAIT_STEP * 1000000UL / getSystemClock() + 1;
+
+    delay_us(us);
+    elapsed = micros() - start;
+    if (elapsed < us || elapsed > us + slack) {
+        printf("delay_us(%lu) at %lu Hz took %lu us\n", (unsigned long)us,
+               (unsigned long)getSystemClock(), (unsigned long)elapsed);
+        assert(0);
+    }
+}
+
+// Wait from a tick_read() stamp; most of the longer waits cross a reload
+static void check_since(uint16_t cycles)
+{
+    uint32_t clk = getSystemClock();
+    uint32_t start_us = micros();
+    uint32_t wanted = (uint32_t)cycles * 1000000UL / clk;
+    uint32_t slack = 2 * HOST_TIMER0_WAIT_STEP * 1000000UL / clk + 1;
+    uint32_t elapsed;
+
+    delay_cycles_since(tick_read(), cycles);
+    elapsed = micros() - start_us;
+    if (elapsed + 1 < wanted || elapsed > wanted + slack) {
+        printf("delay_cycles_since(%u) at %lu Hz took %lu us\n", cycles,
+               (unsigned long)clk, (unsigned long)elapsed);
+        assert(0);
+    }
+}
+
+int main(void)
+{
+    static const uint8_t dividers[] = {1, 2, 16, 48};
+    uint8_t i, j;
+
+    host_reset();
+    millis();
+
+    for (i = 0; i < sizeof(dividers); i++) {
+        assert(setClockDivider(dividers[i]));
+        check(1);
+        check(10);
+        check(300);
+        check(5000);
+        check(70000UL);
+        for (j = 0; j < 5; j++) {
+            check_since(1);
+            check_since((uint16_t)(getSystemClock() / 2000UL));
+            check_since((uint16_t)(getSystemClock() / 1000UL * 3 / 4));
+            delay_us(123);  // Move the start point
+        }
+        printf("delay_us at %lu Hz: OK\n", (unsigned long)getSystemClock());
+    }
+    return 0;
+}
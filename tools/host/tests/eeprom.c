@@ -0,0 +1,137 @@
+// Key/value store on the IAP mock: write coalescing, wear leveling over
+// EEPROM_SECTORS, no 0 -> 1 programs, and power loss at every flash
+// operation of a commit that rotates to the next sector.
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "Arduino.h"
+#include "iap_mock.h"
+
+#define COMMITS 20000UL
+
+static uint8_t snapshot[IAP_MOCK_SIZE];
+
+// Repeated or reverted writes before a commit cost no flash writes
+static void check_coalescing(void)
+{
+    uint32_t writes;
+
+    iap_mock_reset();
+    assert(eepromBegin());
+    assert(eepromRead(3) == EEPROM_UNSET);
+
+    writes = iap_mock_write_count();
+    assert(eepromWrite(3, 10));
+    assert(eepromWrite(3, 11));
+    assert(eepromWrite(3, EEPROM_UNSET));  // Back to the stored value
+    assert(eepromPending() == 0);
+    assert(eepromCommit());
+    assert(iap_mock_write_count() == writes);
+
+    assert(eepromWrite(3, 11));
+    assert(eepromWrite(3, 12));
+    assert(eepromPending() == 1);
+    assert(eepromCommit());
+    assert(iap_mock_write_count() == writes + 4);  // One record
+    assert(!eepromWrite(EEPROM_KEYS, 1));
+}
+
+// Erases are spread evenly over the sectors
+static void check_wear_leveling(void)
+{
+    uint32_t i;
+    uint32_t erases;
+    uint32_t min = 0xFFFFFFFFUL;
+    uint32_t max = 0;
+    uint8_t sector;
+
+    iap_mock_reset();
+    assert(eepromBegin());
+    for (i = 0; i < COMMITS; i++) {
+        assert(eepromWrite((uint8_t)(i % EEPROM_KEYS), (uint16_t)i));
+        assert(eepromCommit());
+    }
+
+    for (sector = 0; sector < EEPROM_SECTORS; sector++) {
+        erases = iap_mock_erase_count(EEPROM_BASE + sector * IAP_SECTOR_SIZE);
+        if (erases < min) min = erases;
+        if (erases > max) max = erases;
+    }
+    printf("%lu commits, %u rotations, erases per sector %lu-%lu\n",
+           (unsigned long)COMMITS, eepromGeneration(), (unsigned long)min,
+           (unsigned long)max);
+    assert(min > 0 && max - min <= 1);
+    assert(iap_mock_violations() == 0);
+
+    // The values survive a reset
+    assert(eepromBegin());
+    for (i = COMMITS - EEPROM_KEYS; i < COMMITS; i++) {
+        assert(eepromRead((uint8_t)(i % EEPROM_KEYS)) == (uint16_t)i);
+    }
+}
+
+static void write_all(uint16_t base)
+{
+    uint8_t key;
+
+    for (key = 0; key < EEPROM_KEYS; key++) {
+        assert(eepromWrite(key, (uint16_t)(base + key)));
+    }
+}
+
+// Power loss after each flash operation of a rotating commit: every key
+// comes back with its old or its new value
+static void check_power_loss(void)
+{
+    uint16_t generation;
+    uint16_t round = 0;
+    int32_t n;
+    uint8_t key;
+    uint16_t value;
+    bool completed = false;
+
+    iap_mock_reset();
+    assert(eepromBegin());
+
+    // Commit all keys until a commit rotates; keep the flash from before it
+    do {
+        memcpy(snapshot, iap_mock_memory(), IAP_MOCK_SIZE);
+        generation = eepromGeneration();
+        round++;
+        write_all((uint16_t)(round * 0x100));
+        assert(eepromCommit());
+    } while (eepromGeneration() == generation);
+
+    for (n = 0; !completed; n++) {
+        memcpy(iap_mock_memory(), snapshot, IAP_MOCK_SIZE);
+        assert(eepromBegin());
+        write_all((uint16_t)(round * 0x100));
+
+        iap_mock_fail_after(n);
+        eepromCommit();
+        iap_mock_power_on();
+        iap_mock_fail_after(-1);
+
+        assert(eepromBegin());
+        completed = eepromGeneration() != generation;  // Rotated
+        for (key = 0; key < EEPROM_KEYS; key++) {
+            value = eepromRead(key);
+            assert(value == (uint16_t)((round - 1) * 0x100 + key) ||
+                   value == (uint16_t)(round * 0x100 + key));
+            if (value != (uint16_t)(round * 0x100 + key)) {
+                completed = false;
+            }
+        }
+        assert(iap_mock_violations() == 0);
+    }
+    printf("power loss at each of %ld operations of a rotation recovered\n", (long)n);
+}
+
+int main(void)
+{
+    check_coalescing();
+    check_wear_leveling();
+    check_power_loss();
+    printf("EEPROM_SECTORS %u: OK\n", EEPROM_SECTORS);
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Wire against the register-file slave: register writes, repeated-start
+// register reads and an absent address. The async transfers poll
+// I2CMSST without HW_WAIT(), so the model does not run them.
+#include <assert.h>
+#include <string.h>
+#include "Arduino.h"
+#include "host_hal.h"
+
+void setup(void) {}
+void loop(void) {}
+
+#define SLAVE 0x68
+
+static uint8_t regs[16];
+
+// Point the slave at reg, then read count bytes after a repeated start
+static void read_regs(uint8_t reg, uint8_t *data, uint8_t count)
+{
+    uint8_t i;
+
+    wireBeginTransmission(SLAVE);
+    wireWrite(reg);
+    assert(wireEndTransmission(false) == 0);
+    assert(wireRequestFrom(SLAVE, count, true) == count);
+    assert(wireAvailable() == count);
+    for (i = 0; i < count; i++) {
+        data[i] = wireRead();
+    }
+    assert(wireAvailable() == 0);
+}
+
+static void check_blocking(void)
+{
+    static const uint8_t written[] = {0xA5, 0x00, 0xFF, 0x3C};
+    uint8_t data[sizeof(written)];
+    uint8_t i;
+
+    wireBeginTransmission(SLAVE);
+    wireWrite(4);
+    for (i = 0; i < sizeof(written); i++) {
+        wireWrite(written[i]);
+    }
+    assert(wireEndTransmission(true) == 0);
+    assert(memcmp(regs + 4, written, sizeof(written)) == 0);
+    assert(regs[3] == 3 && regs[8] == 8);  // Neighbours untouched
+
+    read_regs(4, data, sizeof(data));
+    assert(memcmp(data, written, sizeof(written)) == 0);
+    read_regs(1, data, 2);
+    assert(data[0] == 1 && data[1] == 2);
+}
+
+// The blocking API does not report NAKs; an absent device must just
+// leave the slave alone and read back as a released bus
+static void check_absent(void)
+{
+    uint8_t before[sizeof(regs)];
+
+    memcpy(before, regs, sizeof(regs));
+    wireBeginTransmission(0x50);
+    wireWrite(0);
+    wireWrite(0x77);
+    wireEndTransmission(true);
+    assert(memcmp(before, regs, sizeof(regs)) == 0);
+
+    assert(wireRequestFrom(0x50, 2, true) == 2);
+    assert(wireRead() == 0xFF && wireRead() == 0xFF);
+
+    // The bus still works afterwards
+    wireBeginTransmission(SLAVE);
+    wireWrite(0);
+    wireWrite(0x77);
+    assert(wireEndTransmission(true) == 0);
+    assert(regs[0] == 0x77);
+}
+
+int main(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < sizeof(regs); i++) {
+        regs[i] = i;
+    }
+    host_reset();
+    host_i2c_slave(SLAVE, regs, sizeof(regs));
+    wireBegin();
+
+    check_blocking();
+    check_absent();
+    return 0;
+}
@@ -0,0 +1,46 @@
+// serialPrintNumber() over the int32_t range, including 0 and INT32_MIN,
+// against printf().
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "Arduino.h"
+#include "host_hal.h"
+
+void setup(void) {}
+void loop(void) {}
+
+static void check(int32_t num)
+{
+    char expected[16];
+
+    snprintf(expected, sizeof(expected), "%ld", (long)num);
+    host_uart_clear_output();
+    serialPrintNumber(num);
+    if (strcmp(host_uart_output(NULL), expected) != 0) {
+        printf("serialPrintNumber(%s) printed \"%s\"\n", expected,
+               host_uart_output(NULL));
+        assert(0);
+    }
+}
+
+int main(void)
+{
+    static const int32_t values[] = {
+        0, 1, -1, 9, 10, -10, 99, 100, 65535, 65536, -32768,
+        1000000000L, -1234567890L, INT32_MAX, INT32_MIN, INT32_MIN + 1,
+    };
+    uint32_t seed = 1;
+    uint16_t i;
+
+    host_reset();
+    serialBegin(115200);
+
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        check(values[i]);
+    }
+    for (i = 0; i < 2000; i++) {
+        seed = seed * 1103515245UL + 12345UL;
+        check((int32_t)seed);
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+// serialReadLine() and serialReadLineAsync() on scripted UART input:
+// LF, CR and CRLF endings, lines longer than the buffers and input that
+// overflows the receive ring.
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "Arduino.h"
+#include "host_hal.h"
+
+void setup(void) {}
+void loop(void) {}
+
+static void check_line(const char *expected)
+{
+    const char *line = serialReadLine();
+
+    if (strcmp(line, expected) != 0) {
+        printf("serialReadLine() = \"%s\", expected \"%s\"\n", line, expected);
+        assert(0);
+    }
+}
+
+static void check_endings(void)
+{
+    host_uart_receive_string("lf\ncr\rcrlf\r\n");
+    check_line("lf");
+    check_line("cr");
+    check_line("crlf");
+    check_line("");  // The LF of CRLF ends an empty line
+    assert(serialAvailable() == 0);
+
+    // No terminator: returns what arrived once the input goes quiet
+    host_uart_receive_string("partial");
+    check_line("partial");
+    check_line("");
+}
+
+static void check_overlong(void)
+{
+    char input[80];
+
+    // 63 characters fill the line buffer; the rest is the next line
+    memset(input, 'a', 63);
+    input[63] = '\0';
+    host_uart_receive_string(input);
+    check_line(input);
+    host_uart_receive_string("bc\n");
+    check_line("bc");
+    assert(serialAvailable() == 0);
+
+    // The 64-byte ring keeps 63 bytes and drops the rest
+    memset(input, 'x', 70);
+    input[70] = '\0';
+    host_uart_receive_string(input);
+    assert(serialAvailable() == 63);
+    input[63] = '\0';
+    check_line(input);
+    assert(serialAvailable() == 0);
+}
+
+static void check_async(void)
+{
+    char buffer[8];
+
+    host_uart_receive_string("\r\n\r\nab");
+    assert(!serialReadLineAsync(buffer, sizeof(buffer)));
+    host_uart_receive_string("c\r\n");
+    assert(serialReadLineAsync(buffer, sizeof(buffer)));
+    assert(strcmp(buffer, "abc") == 0);
+    assert(!serialReadLineAsync(buffer, sizeof(buffer)));  // LF of CRLF
+
+    // Overlong lines are truncated to max_len - 1 and the tail dropped
+    host_uart_receive_string("0123456789\n");
+    assert(serialReadLineAsync(buffer, sizeof(buffer)));
+    assert(strcmp(buffer, "0123456") == 0);
+    host_uart_receive_string("next\r");
+    assert(serialReadLineAsync(buffer, sizeof(buffer)));
+    assert(strcmp(buffer, "next") == 0);
+}
+
+int main(void)
+{
+    host_reset();
+    serialBegin(115200);
+
+    check_endings();
+    check_overlong();
+    check_async();
+    return 0;
+}
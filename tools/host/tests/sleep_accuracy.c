@@ -0,0 +1,64 @@
+// millis() compensation after sleepFor(): 100000 sleeps of 7 ms, one of
+// an hour and one of 3e9 ms on the wake-up timer model. millis() must
+// gain exactly the time the wake-up timer counted, to the millisecond,
+// with no drift, and never less than the time requested.
+#include <assert.h>
+#include <stdio.h>
+#include "Arduino.h"
+#include "host_hal.h"
+
+void setup(void) {}
+void loop(void) {}
+
+// Milliseconds the model slept, from the total wake-up timer counts
+static uint32_t slept_ms(void)
+{
+    uint64_t counts = host_wkt_counts();
+
+    return (uint32_t)(counts * 16000ULL / SLEEP_WKT_HZ);
+}
+
+static void check(const char *name, uint32_t start, uint32_t requested)
+{
+    uint32_t gained = millis() - start;
+    uint32_t expected = slept_ms();
+
+    printf("%-18s millis +%lu, wake-up timer %lu ms\n", name,
+           (unsigned long)gained, (unsigned long)expected);
+    assert(gained == expected);
+    assert(gained >= requested);
+}
+
+int main(void)
+{
+    uint32_t start;
+    uint32_t i;
+
+    host_reset();
+    start = millis();
+    for (i = 0; i < 100000UL; i++) {
+        assert(sleepFor(7) == 7);
+    }
+    check("100000 x 7 ms", start, 700000UL);
+
+    host_reset();
+    start = millis();
+    assert(sleepFor(3600000UL) == 3600000UL);
+    check("1 h", start, 3600000UL);
+
+    // Past the 32-bit overflow of ms * counts per second
+    host_reset();
+    start = millis();
+    assert(sleepFor(3000000000UL) == 3000000000UL);
+    check("3e9 ms", start, 3000000000UL);
+
+    // An early wake-up credits only the counts that elapsed
+    host_reset();
+    start = millis();
+    host_wkt_wake_after(100);
+    assert(sleepFor(1000) == slept_ms());
+    check("early wake-up", start, 0);
+
+    printf("SLEEP_WKT_HZ %lu: OK\n", (unsigned long)SLEEP_WKT_HZ);
+    return 0;
+}
@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+"""Build the format table for binary logging and decode LOG_x() frames.
+
+Usage:
+    tools/log-decode.py table SKETCH_DIR [MORE_DIRS...] -o table.json
+    tools/log-decode.py decode --table table.json capture.bin
+    tools/log-decode.py decode --table table.json --port /dev/ttyUSB0
+
+The table maps each LOG_x() call site (file id, line) to its level and
+format. The build writes it as {project}.logtable.json in the build
+folder. Text mode lines and other serial output are passed through.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+FRAME_START = 0x1E
+LEVELS = {'ERROR': 'E', 'WARN': 'W', 'INFO': 'I', 'DEBUG': 'D'}
+SOURCES = ('.c', '.cpp', '.h', '.ino')
+SKIP_DIRS = ('.git', 'bench', 'tools')
+
+CALL = re.compile(r'\bLOG_(ERROR|WARN|INFO|DEBUG)\s*\(\s*((?:"(?:[^"\\\n]|\\.)*"\s*)+)')
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+CONVERSION = re.compile(r'%(0?)(\d*)(?:\.(\d+))?(l?)([diuxXcfs%])')
+
+
+def file_id(name):
+    """Same hash as tools/wrapper/sdcc.sh passes in -DLOG_FILE_ID."""
+    value = 0
+    for c in name:
+        value = (value * 31 + ord(c)) & 0xFFFF
+    return value
+
+
+def compiled_name(path):
+    # The IDE merges the .ino files of a sketch into <folder>.ino.cpp
+    if path.endswith('.ino'):
+        return os.path.basename(os.path.dirname(os.path.abspath(path))) + '.ino.cpp'
+    return os.path.basename(path)
+
+
+def unescape(literal):
+    return literal.encode('latin-1', 'backslashreplace').decode('unicode_escape')
+
+
+def close_paren(text, pos):
+    """Index of the ')' that closes the call starting before pos."""
+    depth = 1
+    in_string = False
+    while pos < len(text):
+        c = text[pos]
+        if in_string:
+            if c == '\\':
+                pos += 1
+            elif c == '"':
+                in_string = False
+        elif c == '"':
+            in_string = True
+        elif c == '(':
+            depth += 1
+        elif c == ')':
+            depth -= 1
+            if depth == 0:
+                return pos
+        pos += 1
+    return pos
+
+
+def scan_file(path, entries, warnings):
+    with open(path, encoding='utf-8', errors='replace') as f:
+        text = f.read()
+
+    name = compiled_name(path)
+    fid = file_id(name)
+    for match in CALL.finditer(text):
+        fmt = ''.join(unescape(s) for s in LITERAL.findall(match.group(2)))
+        first = text.count('\n', 0, match.start()) + 1
+        last = text.count('\n', 0, close_paren(text, match.end())) + 1
+
+        # __LINE__ of a call spread over several lines depends on the
+        # preprocessor, so register every line of it
+        for line in range(first, last + 1):
+            key = '%d:%d' % (fid, line)
+            entry = {'level': match.group(1), 'format': fmt, 'file': path, 'line': first}
+            other = entries.get(key)
+            if other and (other['file'], other['line']) != (path, first):
+                warnings.append('%s:%d and %s:%d share id %04X line %d' % (
+                    other['file'], other['line'], path, first, fid, line))
+            entries[key] = entry
+
+
+def build_table(paths):
+    entries = {}
+    warnings = []
+    for top in paths:
+        if os.path.isfile(top):
+            scan_file(top, entries, warnings)
+            continue
+        for root, dirs, files in os.walk(top):
+            dirs[:] = sorted(d for d in dirs if d not in SKIP_DIRS)
+            for name in sorted(files):
+                if name.endswith(SOURCES):
+                    scan_file(os.path.join(root, name), entries, warnings)
+    return entries, warnings
+
+
+def format_args(fmt, args):
+    """serialPrintf() formatting with the 16-bit int rules of the target."""
+    args = list(args)
+
+    def convert(match):
+        zero, width, precision, is_long, kind = match.groups()
+        if kind == '%':
+            return '%'
+        value = args.pop(0) if args else 0
+        if kind == 's':
+            return '<str>'  # Strings are not sent in frames
+        signed = kind in 'dif'
+        if not is_long:
+            value &= 0xFFFF
+            if signed and value & 0x8000:
+                value -= 0x10000
+        elif not signed:
+            value &= 0xFFFFFFFF
+        if kind == 'c':
+            return chr(value & 0xFF)
+        if kind == 'f':
+            # %.Nf of an integer scaled by 10^N, as serialPrintf() prints it
+            digits = int(precision or 0)
+            text = '%d' % abs(value)
+            if digits:
+                text = text.rjust(digits + 1, '0')
+                text = text[:-digits] + '.' + text[-digits:]
+            sign = '-' if value < 0 else ''
+            if zero:
+                return sign + text.rjust(int(width or 0) - len(sign), '0')
+            return (sign + text).rjust(int(width or 0))
+        return ('%' + zero + width + kind.replace('i', 'd')) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+class FrameDecoder:
+    """Splits a byte stream into text and decoded LOG_x() frames."""
+
+    def __init__(self, table):
+        self.table = table
+        self.text = b''
+        self.frame = None
+
+    def feed(self, data):
+        out = []
+        for byte in data:
+            if self.frame is None:
+                if byte == FRAME_START:
+                    self.frame = bytearray()
+                elif byte == 0x0A:
+                    out.append(self.text.rstrip(b'\r').decode('latin-1'))
+                    self.text = b''
+                else:
+                    self.text += bytes([byte])
+                continue
+
+            self.frame.append(byte)
+            line = self.decode(self.frame)
+            if line is not None:
+                out.append(line)
+                self.frame = None
+        return out
+
+    def decode(self, frame):
+        """Text of a complete frame, or None while more bytes are needed."""
+        if len(frame) < 5:
+            return None
+        fid = frame[0] | (frame[1] << 8)
+        line = frame[2] | (frame[3] << 8)
+        argc = frame[4]
+
+        args = []
+        value = 0
+        shift = 0
+        for byte in frame[5:]:
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                args.append((value >> 1) ^ -(value & 1))
+                value = 0
+                shift = 0
+        if len(args) < argc:
+            return None
+
+        entry = self.table.get('%d:%d' % (fid, line))
+        if entry is None:
+            return '?: id %04X line %d %s' % (fid, line, args)
+        return '%s: %s' % (LEVELS[entry['level']], format_args(entry['format'], args))
+
+
+def read_port(port, baud, decoder):
+    try:
+        import serial
+    except ImportError:
+        raise SystemExit('pyserial is needed for --port (pip install pyserial)')
+
+    with serial.Serial(port, baud, timeout=0.1) as link:
+        while True:
+            for line in decoder.feed(link.read(256)):
+                print(line, flush=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    commands = parser.add_subparsers(dest='command', required=True)
+
+    table = commands.add_parser('table', help='Scan sources for LOG_x() calls')
+    table.add_argument('paths', nargs='+', help='Source files or folders')
+    table.add_argument('-o', '--output', required=True, help='Table to write (JSON)')
+
+    decode = commands.add_parser('decode', help='Decode a capture or serial port')
+    decode.add_argument('capture', nargs='?', help='Binary capture of the serial output')
+    decode.add_argument('--table', required=True, help='Table written by the build')
+    decode.add_argument('--port', help='Serial port to read from')
+    decode.add_argument('--baud', type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.command == 'table':
+        entries, warnings = build_table(args.paths)
+        for warning in warnings:
+            print('log-decode: warning: ' + warning, file=sys.stderr)
+        with open(args.output, 'w') as f:
+            json.dump(entries, f, indent=1, sort_keys=True)
+        return
+
+    with open(args.table) as f:
+        decoder = FrameDecoder(json.load(f))
+
+    if args.port:
+        read_port(args.port, args.baud, decoder)
+        return
+    if args.capture:
+        with open(args.capture, 'rb') as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    lines = decoder.feed(data)
+    if decoder.text:
+        lines.append(decoder.text.decode('latin-1'))
+    for line in lines:
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
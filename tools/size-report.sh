@@ -0,0 +1,87 @@
+#!/bin/bash
+# Flash/XRAM size table for the bundled examples
+#
+# Usage: tools/size-report.sh [baseline-ref]
+#
+# Builds every example under libraries/*/examples with arduino-cli and
+# prints a markdown table of flash and XRAM use, read from the .mem file
+# SDCC writes next to the .ihx. With a git ref the same examples are also
+# built from that revision (checked out into a temporary worktree), so
+# the table shows before/after columns.
+#
+# Environment:
+#   FQBN       Board to build for (default stc8051:stc8:stc8g1k08a)
+#   SDCC_HOME  SDCC install to use instead of the board manager tool
+
+FQBN="${FQBN:-stc8051:stc8:stc8g1k08a}"
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+BASELINE="$1"
+WORK="$(mktemp -d)"
+
+cleanup() {
+    if [ -n "$BASELINE" ]; then
+        git -C "$ROOT" worktree remove --force "$WORK/baseline" > /dev/null 2>&1
+    fi
+    rm -rf "$WORK"
+}
+trap cleanup EXIT
+
+if ! command -v arduino-cli > /dev/null; then
+    echo "arduino-cli not found in PATH" >&2
+    exit 1
+fi
+
+EXTRA_PROPS=()
+if [ -n "$SDCC_HOME" ]; then
+    EXTRA_PROPS=(--build-property "runtime.tools.sdcc.path=$SDCC_HOME")
+fi
+
+# Build one example against a core tree; prints "flash xram" or "- -"
+build_size() {
+    local tree="$1" sketch="$2" tag="$3"
+    local user="$WORK/user-$tag"
+    local build="$WORK/build-$tag-$(basename "$sketch")"
+    local mem
+
+    # Serve the tree as a sketchbook hardware platform
+    mkdir -p "$user/hardware/${FQBN%%:*}"
+    ln -sfn "$tree" "$user/hardware/${FQBN%%:*}/$(echo "$FQBN" | cut -d: -f2)"
+
+    if ! ARDUINO_DIRECTORIES_USER="$user" arduino-cli compile --fqbn "$FQBN" \
+            --build-path "$build" "${EXTRA_PROPS[@]}" "$sketch" > "$build.log" 2>&1; then
+        echo "- -"
+        return
+    fi
+
+    mem=$(ls "$build"/*.mem 2> /dev/null | head -1)
+    awk '/ROM\/EPROM\/FLASH/ { flash = $4 }
+         /EXTERNAL RAM/      { xram = $5 }
+         END { print (flash ? flash : "-"), (xram ? xram : "-") }' "$mem"
+}
+
+if [ -n "$BASELINE" ]; then
+    git -C "$ROOT" worktree add --detach "$WORK/baseline" "$BASELINE" > /dev/null || exit 1
+    echo "| Example | Flash ($BASELINE) | Flash (now) | Saved | XRAM ($BASELINE) | XRAM (now) |"
+    echo "|---------|------:|------:|------:|------:|------:|"
+else
+    echo "| Example | Flash | XRAM |"
+    echo "|---------|------:|-----:|"
+fi
+
+find "$ROOT/libraries" -path '*/examples/*' -name '*.ino' | sort | while read -r ino; do
+    sketch="$(dirname "$ino")"
+    name="$(basename "$sketch")"
+    read -r flash xram <<< "$(build_size "$ROOT" "$sketch" now)"
+
+    if [ -n "$BASELINE" ]; then
+        base_sketch="$WORK/baseline/${sketch#$ROOT/}"
+        read -r base_flash base_xram <<< "$(build_size "$WORK/baseline" "$base_sketch" base)"
+        saved="-"
+        if [ "$flash" != "-" ] && [ "$base_flash" != "-" ]; then
+            saved=$((base_flash - flash))
+        fi
+        echo "| $name | $base_flash | $flash | $saved | $base_xram | $xram |"
+    else
+        echo "| $name | $flash | $xram |"
+    fi
+done
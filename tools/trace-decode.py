@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Decode a traceDump() capture into a timeline and per-span timings.
+
+Usage:
+    tools/trace-decode.py capture.bin
+    tools/trace-decode.py --port /dev/ttyUSB0 [--baud 115200]
+
+With --port the script waits for the next dump on the serial port
+(needs pyserial). Times are in microseconds from the first record;
+spans pair TRACE_ID_x with TRACE_END(TRACE_ID_x).
+"""
+
+import argparse
+import sys
+
+NAMES = {
+    0x01: 'INT0',
+    0x02: 'INT1',
+    0x03: 'INT2',
+    0x04: 'INT3',
+    0x05: 'INT4',
+    0x06: 'UART1',
+    0x07: 'TICK',
+    0x08: 'I2C',
+}
+END = 0x80
+HEADER = b'TRC'
+
+
+def name(event_id):
+    base = event_id & ~END
+    label = NAMES.get(base, 'USER%02X' % base if base >= 0x20 else 'ID%02X' % base)
+    return label + ('/end' if event_id & END else '')
+
+
+def read_port(port, baud):
+    try:
+        import serial
+    except ImportError:
+        raise SystemExit('pyserial is needed for --port (pip install pyserial)')
+
+    with serial.Serial(port, baud, timeout=None) as link:
+        window = b''
+        while window != HEADER:
+            window = (window + link.read(1))[-3:]
+        head = link.read(3)
+        return HEADER + head + link.read(head[0] * 4)
+
+
+def parse(data):
+    start = data.find(HEADER)
+    if start < 0 or len(data) < start + 6:
+        raise SystemExit('no trace header found')
+    count = data[start + 3]
+    cycles_per_ms = data[start + 4] | (data[start + 5] << 8)
+    body = data[start + 6:start + 6 + count * 4]
+    if len(body) < count * 4:
+        raise SystemExit('trace truncated: %d of %d records' % (len(body) // 4, count))
+    return cycles_per_ms, [tuple(body[i:i + 4]) for i in range(0, len(body), 4)]
+
+
+def timeline(cycles_per_ms, records):
+    """Convert (id, ms, th, tl) records into (time_us, id)."""
+    reload = 0x10000 - cycles_per_ms
+    events = []
+    ms_full = None
+    last_us = None
+
+    for event_id, ms, th, tl in records:
+        # Unwrap the 8-bit millisecond stamp
+        if ms_full is None:
+            ms_full = ms
+        else:
+            ms_full += (ms - ms_full) & 0xFF
+
+        elapsed = (((th << 8) | tl) - reload) & 0xFFFF
+        elapsed = min(elapsed, cycles_per_ms - 1)
+        us = ms_full * 1000.0 + elapsed * 1000.0 / cycles_per_ms
+
+        # The counter reloads before the tick ISR increments millis()
+        if last_us is not None and us < last_us - 500:
+            us += 1000.0
+            ms_full += 1
+        last_us = us
+        events.append((us, event_id))
+
+    if events:
+        origin = events[0][0]
+        events = [(us - origin, event_id) for us, event_id in events]
+    return events
+
+
+def spans(events):
+    open_spans = {}
+    durations = {}
+    for us, event_id in events:
+        base = event_id & ~END
+        if event_id & END:
+            if open_spans.get(base):
+                durations.setdefault(base, []).append(us - open_spans[base].pop())
+        else:
+            open_spans.setdefault(base, []).append(us)
+    return durations
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('capture', nargs='?', help='Binary capture of the dump')
+    parser.add_argument('--port', help='Serial port to read the dump from')
+    parser.add_argument('--baud', type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.port:
+        data = read_port(args.port, args.baud)
+    elif args.capture:
+        with open(args.capture, 'rb') as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    cycles_per_ms, records = parse(data)
+    events = timeline(cycles_per_ms, records)
+
+    print('%d records, %d timer clocks per ms' % (len(records), cycles_per_ms))
+    print()
+    print('%12s %10s  %s' % ('time_us', 'delta_us', 'event'))
+    previous = 0.0
+    for us, event_id in events:
+        print('%12.1f %10.1f  %s' % (us, us - previous, name(event_id)))
+        previous = us
+
+    durations = spans(events)
+    if durations:
+        print()
+        print('%-8s %6s %10s %10s %10s' % ('span', 'count', 'min_us', 'avg_us', 'max_us'))
+        for base in sorted(durations):
+            values = durations[base]
+            print('%-8s %6d %10.1f %10.1f %10.1f' % (
+                name(base), len(values), min(values), sum(values) / len(values), max(values)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,3 @@
+@echo off
+python "%~dp0..\log-decode.py" table %2 %3 %4 %5 %6 -o %1
+exit /b 0
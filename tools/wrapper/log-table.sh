@@ -0,0 +1,15 @@
+#!/bin/bash
+
+# Prebuild hook: write the LOG_x() format table for tools/log-decode.py
+#
+# Usage: log-table.sh OUTPUT.json SOURCE_DIRS...
+#
+# Only needed for binary logging (LOG_BINARY=1); skipped quietly without
+# python3 so it never breaks a build.
+
+if command -v python3 > /dev/null; then
+	OUTPUT=$1
+	shift
+	python3 "$(dirname "$0")/../log-decode.py" table "$@" -o "$OUTPUT"
+fi
+exit 0
@@ -51,9 +51,12 @@ while [ $# -gt 0 ]; do
     shift
 done
 
-# Iteratively resolve undefined symbols by adding needed drivers
+# Iteratively resolve undefined symbols by adding needed drivers.
+# Drivers are split into one function per file, so every round adds the
+# providers of all symbols reported missing, and the round limit grows
+# with the number of driver files.
 NEEDED_DRIVERS=""
-MAX_ITERATIONS=10
+MAX_ITERATIONS=$(( $(echo $DRIVER_FILES | wc -w) + 1 ))
 
 for iteration in $(seq 1 $MAX_ITERATIONS); do
     # Try linking with current set
@@ -68,11 +71,11 @@ for iteration in $(seq 1 $MAX_ITERATIONS); do
     # Extract undefined symbol names from error output
     # The format is: "?ASlink-Warning-Undefined Global _symbol_name referenced by module"
     # We want to extract "symbol_name" (without the leading underscore)
-    UNDEFINED=$(grep -oP "(?<=Undefined Global _)[^\s]+" /tmp/sdcc_link_$$.txt 2>/dev/null | head -1)
+    UNDEFINED=$(grep -oP "(?<=Undefined Global _)[^\s]+" /tmp/sdcc_link_$$.txt 2>/dev/null | sort -u)
     
     # If that didn't work, try alternative format
     if [ -z "$UNDEFINED" ]; then
-        UNDEFINED=$(grep -oP "(?<=Undefined: _)[^\s]+" /tmp/sdcc_link_$$.txt 2>/dev/null | head -1)
+        UNDEFINED=$(grep -oP "(?<=Undefined: _)[^\s]+" /tmp/sdcc_link_$$.txt 2>/dev/null | sort -u)
     fi
     
     # If no undefined symbols found, stop
@@ -82,26 +85,26 @@ for iteration in $(seq 1 $MAX_ITERATIONS); do
         break
     fi
     
-    # Search for which driver file provides this symbol
-    FOUND_DRIVER=""
-    for DRIVER in $DRIVER_FILES; do
-        # Skip if already added
-        if echo "$NEEDED_DRIVERS" | grep -q "$DRIVER"; then
-            continue
-        fi
-        
-        # Check if this driver defines the symbol (look for "S _symbol Def")
-        if grep -q "^S _${UNDEFINED} Def" "$DRIVER" 2>/dev/null; then
-            FOUND_DRIVER="$DRIVER"
-            break
-        fi
+    # Search for which driver files provide these symbols
+    FOUND_ANY=""
+    for SYMBOL in $UNDEFINED; do
+        for DRIVER in $DRIVER_FILES; do
+            # Skip if already added
+            case " $NEEDED_DRIVERS " in
+                *" $DRIVER "*) continue ;;
+            esac
+            
+            # Check if this driver defines the symbol (look for "S _symbol Def")
+            if grep -q "^S _${SYMBOL} Def" "$DRIVER" 2>/dev/null; then
+                NEEDED_DRIVERS="$NEEDED_DRIVERS $DRIVER"
+                FOUND_ANY=1
+                break
+            fi
+        done
     done
     
-    # If we found the driver, add it
-    if [ -n "$FOUND_DRIVER" ]; then
-        NEEDED_DRIVERS="$NEEDED_DRIVERS $FOUND_DRIVER"
-    else
-        # No driver provides this symbol, stop trying
+    # No driver provides the missing symbols, stop trying
+    if [ -z "$FOUND_ANY" ]; then
         cat /tmp/sdcc_link_$$.txt >&2
         break
     fi
@@ -111,6 +114,11 @@ done
 $SDCC $FLAGS $REL_FILES $NEEDED_DRIVERS
 RESULT=$?
 
+# RAM breakdown from the .mem file next to the output
+if [ $RESULT -eq 0 ] && [ -n "$OUTPUT" ] && command -v python3 > /dev/null; then
+    python3 "$(dirname "$0")/sdcc_link_wrapper.py" --ram-report "${OUTPUT%.*}.mem"
+fi
+
 # Cleanup
 for FILE in $CLEANUP_FILES; do
     rm -f "$FILE"
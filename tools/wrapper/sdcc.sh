@@ -82,6 +82,16 @@ REL=${OBJ%.o}.rel
 MARK=$4
 shift 4
 
+# Per-file id for binary logging (cores/stc8/log.h). Same hash as
+# tools/log-decode.py: h = h * 31 + c over the file name, 16 bits.
+NAME=${SRC##*/}
+NAME=${NAME##*\\}
+LOG_FILE_ID=0
+for (( i=0; i<${#NAME}; i++ )); do
+	printf -v C '%d' "'${NAME:i:1}"
+	LOG_FILE_ID=$(( (LOG_FILE_ID * 31 + C) & 0xFFFF ))
+done
+
 if [ $VERBOSE -gt 0 ]; then
 	>&2 echo -ne "${GREEN}Mark $MARK:${OFF}"
 	>&2 echo "$SDCC" "$@" "$SRC" -o "$OBJ"
@@ -90,12 +100,12 @@ fi
 case "$SRC" in
 	*.cpp)
 		# use -x c to compile as c, add a reference to main to pull in main.c
-		"$SDCC" "$@" -x c --include dummy_variable_main.h "$SRC"  -o "$OBJ"
+		"$SDCC" "$@" -DLOG_FILE_ID=$LOG_FILE_ID -x c --include dummy_variable_main.h "$SRC"  -o "$OBJ"
 		ERR=$?
 		;;
 	*.c)
 		# compile a .c file
-		"$SDCC" "$@" "$SRC" -o "$OBJ"
+		"$SDCC" "$@" -DLOG_FILE_ID=$LOG_FILE_ID "$SRC" -o "$OBJ"
 		ERR=$?
 		;;
 esac
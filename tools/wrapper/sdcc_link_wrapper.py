@@ -1,15 +1,71 @@
 import sys
 import subprocess
 import os
+import re
 import shutil
 
+# Warn when less internal RAM than this is left for the stack
+STACK_WARN_BYTES = 32
+
+def ram_report(mem_file):
+    """Print internal and external RAM use from the linker's .mem file"""
+    try:
+        with open(mem_file, 'r', errors='ignore') as f:
+            lines = f.readlines()
+    except OSError:
+        return
+
+    # Internal RAM map: one character per byte, e.g. "0x10:|a|a|Q|Q| | |"
+    cells = {}
+    for line in lines:
+        if re.match(r'0x[0-9a-fA-F]{2}:\|', line):
+            for cell in line.split('|')[1:-1]:
+                cells[cell] = cells.get(cell, 0) + 1
+
+    banks = sum(cells.get(c, 0) for c in '0123')
+    data = sum(n for c, n in cells.items() if c.islower())
+    overlay = cells.get('Q', 0)
+    bits = cells.get('B', 0) + cells.get('T', 0)
+    idata = cells.get('I', 0)
+    absolute = cells.get('A', 0)
+
+    stack_start = stack_free = None
+    external = {}
+    for line in lines:
+        m = re.search(r'Stack starts at:\s*0x([0-9a-fA-F]+).*?(\d+) bytes available', line)
+        if m:
+            stack_start, stack_free = int(m.group(1), 16), int(m.group(2))
+        m = re.match(r'\s*(PAGED EXT\. RAM|EXTERNAL RAM)\s+0x\w+\s+0x\w+\s+(\d+)\s+(\d+)', line)
+        if m:
+            external[m.group(1)] = (int(m.group(2)), int(m.group(3)))
+
+    print('RAM usage:')
+    print('  register banks %4d bytes' % banks)
+    print('  data           %4d bytes (overlay %d, bits %d, absolute %d)' % (data + overlay + bits + absolute, overlay, bits, absolute))
+    print('  idata          %4d bytes' % idata)
+    if stack_start is not None:
+        print('  stack          %4d bytes free from 0x%02x' % (stack_free, stack_start))
+    if 'PAGED EXT. RAM' in external:
+        print('  pdata          %4d of %d bytes' % external['PAGED EXT. RAM'])
+    if 'EXTERNAL RAM' in external:
+        print('  xdata          %4d of %d bytes' % external['EXTERNAL RAM'])
+    if stack_free is not None and stack_free < STACK_WARN_BYTES:
+        print('warning: only %d bytes of internal RAM left for the stack' % stack_free)
+
+# Report mode, also used by sdcc-link.sh: sdcc_link_wrapper.py --ram-report file.mem
+if len(sys.argv) == 3 and sys.argv[1] == '--ram-report':
+    ram_report(sys.argv[2])
+    sys.exit(0)
+
 # Get SDCC path and normalize
 sdcc = sys.argv[1].replace('/', '\\')
 if sdcc.endswith('sdcc'):
     sdcc += '.exe'
 
-# Process all other arguments
+# Process all other arguments; driver objects are held back and only
+# linked once something references them (same as sdcc-link.sh)
 args = []
+driver_files = []
 for arg in sys.argv[2:]:
     # Normalize all paths (replace forward slashes)
     normalized_arg = arg.replace('/', '\\')
@@ -19,7 +75,10 @@ for arg in sys.argv[2:]:
         rel_file = normalized_arg.replace('.o', '.rel')
         if not os.path.exists(rel_file) and os.path.exists(normalized_arg):
             shutil.copy2(normalized_arg, rel_file)
-        args.append(rel_file)
+        if '\\drivers\\src\\' in rel_file:
+            driver_files.append(rel_file)
+        else:
+            args.append(rel_file)
     elif normalized_arg.endswith('.a'):
         # Convert .a to .lib
         lib_file = normalized_arg.replace('.a', '.lib')
@@ -46,8 +105,41 @@ with open(os.path.join(os.environ.get('TEMP', 'C:\\'), 'sdcc_link_debug.txt'), '
             if os.path.exists(lib_path):
                 f.write(f"Contents: {os.listdir(lib_path)}\n")
 
+def defines_symbol(rel_file, symbol):
+    try:
+        with open(rel_file, 'r', errors='ignore') as f:
+            return any(line.startswith('S _' + symbol + ' Def') for line in f)
+    except OSError:
+        return False
+
+# Iteratively resolve undefined symbols by adding the driver defining them
+needed_drivers = []
+for _ in range(len(driver_files) + 1):
+    probe = subprocess.run([sdcc] + args + needed_drivers, capture_output=True, text=True)
+    if probe.returncode == 0:
+        break
+
+    output = probe.stdout + probe.stderr
+    symbols = set(re.findall(r'Undefined Global _(\S+)', output) or
+                  re.findall(r'Undefined: _(\S+)', output))
+
+    providers = []
+    for symbol in sorted(symbols):
+        provider = next((d for d in driver_files if d not in needed_drivers
+                         and d not in providers and defines_symbol(d, symbol)), None)
+        if provider:
+            providers.append(provider)
+    if not providers:
+        break
+    needed_drivers.extend(providers)
+
 # Build and execute command
-cmd = [sdcc] + args
+cmd = [sdcc] + args + needed_drivers
 result = subprocess.run(cmd)
 
+# RAM breakdown from the .mem file next to the output
+if result.returncode == 0 and '-o' in args:
+    output = args[args.index('-o') + 1].strip('"')
+    ram_report(os.path.splitext(output)[0] + '.mem')
+
 sys.exit(result.returncode)
\ No newline at end of file
@@ -12,6 +12,13 @@ obj = sys.argv[3]
 mark = sys.argv[4]
 flags = sys.argv[5:]
 
+# Per-file id for binary logging (cores/stc8/log.h), same hash as
+# tools/log-decode.py
+log_file_id = 0
+for c in os.path.basename(src):
+    log_file_id = (log_file_id * 31 + ord(c)) & 0xFFFF
+flags.append('-DLOG_FILE_ID=%d' % log_file_id)
+
 # Check if .cpp
 cpp_flags = []
 if src.lower().endswith('.cpp'):
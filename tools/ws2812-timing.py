@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Generate the WS2812 bit loop padding for each Clock Speed in boards.txt.
+
+Usage:
+    tools/ws2812-timing.py > libraries/4.WS2812/src/ws2812_timing.h
+
+The bit loop in ws2812_private.h is
+
+    setb  PIN          ; rising edge
+    <PAD_T0H nops>
+    mov   PIN, c       ; falls here for a 0 bit
+    <PAD_T1H nops>
+    clr   PIN          ; falls here for a 1 bit
+    <PAD_LOW nops>
+    rlc   a
+    djnz  r7, loop
+
+and each pad is the number of NOPs that brings the high times and the
+bit period to the targets below at that clock.
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# STC8G (1T core) instruction clocks used by the loop
+CLOCKS = {'setb': 1, 'clr': 1, 'mov_bit_c': 1, 'rlc': 1, 'djnz': 3, 'nop': 1}
+
+# Targets in ns. WS2812B reads a high pulse under ~550 ns as 0 and over
+# ~650 ns as 1; the low time may stretch to several us between bytes.
+T0H_NS = 350
+T1H_NS = 750
+BIT_NS = 1250
+
+
+def clock_speeds():
+    with open(os.path.join(ROOT, 'boards.txt')) as f:
+        values = re.findall(r'^stc8g1k08a\.menu\.clock\.\w+\.build\.f_cpu=(\d+)L', f.read(), re.M)
+    return sorted(set(int(v) for v in values))
+
+
+def pads(f_cpu):
+    def clocks(ns):
+        return int(ns * f_cpu / 1e9 + 0.5)
+
+    t0h = max(clocks(T0H_NS), CLOCKS['mov_bit_c'] + 1)
+    pad_t0h = t0h - CLOCKS['mov_bit_c']
+    pad_t1h = max(clocks(T1H_NS) - t0h - CLOCKS['clr'], 0)
+    t1h = t0h + pad_t1h + CLOCKS['clr']
+    loop = CLOCKS['rlc'] + CLOCKS['djnz'] + CLOCKS['setb']
+    pad_low = max(clocks(BIT_NS) - t1h - loop, 0)
+    period = t1h + pad_low + loop
+    ns = 1e9 / f_cpu
+    return pad_t0h, pad_t1h, pad_low, t0h * ns, t1h * ns, period * ns
+
+
+def nops(count):
+    return '"' + 'nop\\n' * count + '"' if count else '""'
+
+
+def main():
+    out = sys.stdout
+    out.write('#ifndef WS2812_TIMING_H\n#define WS2812_TIMING_H\n\n')
+    out.write('// Generated by tools/ws2812-timing.py from the Clock Speed menu in\n')
+    out.write('// boards.txt. Do not edit; change the script and run it again.\n//\n')
+    out.write('//   F_CPU       T0H ns  T1H ns  bit ns\n')
+    rows = [(f, pads(f)) for f in clock_speeds()]
+    for f_cpu, (_, _, _, t0h, t1h, period) in rows:
+        out.write('//   %-10d  %6.0f  %6.0f  %6.0f\n' % (f_cpu, t0h, t1h, period))
+    out.write('\n')
+
+    keyword = '#if'
+    for f_cpu, (pad_t0h, pad_t1h, pad_low, _, _, _) in rows:
+        out.write('%s F_CPU == %dL\n' % (keyword, f_cpu))
+        out.write('#define WS2812_PAD_T0H %s\n' % nops(pad_t0h))
+        out.write('#define WS2812_PAD_T1H %s\n' % nops(pad_t1h))
+        out.write('#define WS2812_PAD_LOW %s\n' % nops(pad_low))
+        keyword = '#elif'
+    out.write('#else\n#error "WS2812: no bit timing for this F_CPU, run tools/ws2812-timing.py"\n')
+    out.write('#endif\n\n#endif // WS2812_TIMING_H\n')
+
+
+if __name__ == '__main__':
+    main()
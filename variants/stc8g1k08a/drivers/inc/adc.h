@@ -0,0 +1,73 @@
+#ifndef ADC_H
+#define ADC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Pass as rate_hz to convert back-to-back instead of on a timer
+#define ADC_FREE_RUNNING 0
+
+// Continuous mode limits
+#define ADC_MAX_OVERSAMPLE_BITS 3 // 4^3 = 64 samples -> 13-bit result
+#define ADC_MAX_AVERAGE_SHIFT   6 // Running average over ~64 results
+
+/**
+ * @brief Read an analog pin (blocking)
+ * @param pin P3_0..P5_5, or ADC_CHANNEL_VREF for the internal reference
+ * @return 10-bit result (0-1023)
+ *
+ * While continuous mode is running this returns the latest filtered
+ * value instead of starting a new conversion.
+ */
+uint16_t analogRead(uint8_t pin);
+
+/**
+ * @brief Start sampling a pin continuously from the ADC interrupt
+ * @param pin     Analog pin to sample
+ * @param rate_hz Conversions per second paced by TIMER_SPARE, or
+ *                ADC_FREE_RUNNING to convert back-to-back
+ * @return false if the rate cannot be generated at the current clock
+ *         or the spare timer is owned by another driver
+ *
+ * Filtered results are queued in a ring buffer; read them with
+ * analogContinuousRead().
+ */
+bool analogContinuousBegin(uint8_t pin, uint16_t rate_hz);
+
+/**
+ * @brief Configure on-the-fly filtering for continuous mode
+ * @param oversample_bits Extra resolution bits (0-3). Each result is the
+ *                        sum of 4^bits conversions shifted right by bits,
+ *                        so one value is queued per 4^bits conversions.
+ * @param average_shift   Running average weight 1/2^shift (0 = off)
+ */
+void analogContinuousFilter(uint8_t oversample_bits, uint8_t average_shift);
+
+/**
+ * @brief Stop continuous sampling and release the pacing timer
+ */
+void analogContinuousEnd(void);
+
+/**
+ * @brief Number of filtered values waiting in the buffer
+ */
+uint8_t analogContinuousAvailable(void);
+
+/**
+ * @brief Take the oldest filtered value from the buffer
+ * @return The value, or the latest value if the buffer is empty
+ */
+uint16_t analogContinuousRead(void);
+
+/**
+ * @brief Most recent filtered value
+ */
+uint16_t analogContinuousLatest(void);
+
+/**
+ * @brief Number of values dropped because the buffer was full
+ */
+uint8_t analogContinuousDropped(void);
+
+#endif // ADC_H
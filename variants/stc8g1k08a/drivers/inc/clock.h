@@ -0,0 +1,51 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Maximum number of clock change listeners (core drivers use up to 5)
+#define CLOCK_MAX_LISTENERS 6
+
+// Called after the system clock changed; read the new value with getSystemClock()
+typedef void (*ClockListener_t)(void);
+
+/**
+ * @brief Current system clock in Hz
+ *
+ * Equals F_CPU until setClockDivider() is called.
+ */
+uint32_t getSystemClock(void);
+
+/**
+ * @brief Current master clock divider (CLKDIV)
+ */
+uint8_t getClockDivider(void);
+
+/**
+ * @brief Change the system clock at runtime
+ * @param divider Master clock divider (1-255). The divider set at startup
+ *                gives F_CPU; larger values run slower.
+ * @return false if divider is 0
+ *
+ * Serial baud rate, the millis() tick, I2C speed and ADC pacing are
+ * recomputed automatically, and so is the clockOut()/tone() frequency.
+ * PWM frequencies scale with the clock.
+ *
+ * Example:
+ *   uint8_t run = getClockDivider();
+ *   setClockDivider(run * 8);  // Idle at F_CPU / 8
+ *   setClockDivider(run);      // Back to F_CPU
+ */
+bool setClockDivider(uint8_t divider);
+
+/**
+ * @brief Register a function to call after every clock change
+ * @return false if the listener table is full
+ *
+ * Registering the same function twice has no effect.
+ */
+bool clockAddListener(ClockListener_t listener);
+
+#endif // CLOCK_H
@@ -0,0 +1,74 @@
+#ifndef CLOCK_OUT_H
+#define CLOCK_OUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Square waves generated in hardware, no CPU time once started.
+//
+// The 8-pin package has no T0CLKO/T1CLKO pins, so the output is a PCA
+// module in 6-bit PWM at 50% duty, with the PCA counter clocked by Timer0
+// overflows:
+//
+//   f = SYSclk / (64 * N)      N = 2 .. 65536 Timer0 clocks (x12 below ~6 Hz)
+//
+// This needs Timer0, so it works when the tick runs on Timer2 (Tools >
+// Tick Timer > Timer2). P5_4 can also output the system clock divided
+// by 1..127 (MCLKO), which needs no timer and works with any tick timer.
+//
+// While the output runs the PCA counts Timer0 overflows: analogWrite()
+// on the other CCP pins runs at f * 64 / 2^bits and capture timestamps
+// are not usable. The previous PCA clock is restored when it stops.
+
+// Number of PCA counts per output period (6-bit PWM)
+#define CLOCK_OUT_PCA_COUNTS 64
+
+// Largest MCLKO divider (MCLKOCR bits 6:0)
+#define CLOCK_OUT_MCLKO_MAX_DIV 127
+
+/**
+ * @brief Output a square wave on a CCP pin until stopped
+ * @param pin P3_2, P3_3 or P5_4
+ * @param hz  Requested frequency; 0 stops the output
+ * @return Frequency actually generated in Hz (rounded), 0 if the pin has
+ *         no output, Timer0 or the PCA clock is not free (counterBegin())
+ *         or hz is out of range
+ *
+ * The nearest reachable frequency is used; compare the return value
+ * with hz for the error. On P5_4 the Timer0 and MCLKO paths are both
+ * tried and the closer one wins. Only one output runs at a time:
+ * starting another moves it to the new pin. The frequency is kept
+ * across setClockDivider() as far as the new clock allows.
+ */
+uint32_t clockOut(uint8_t pin, uint32_t hz);
+
+/**
+ * @brief Play a tone
+ * @param pin         P3_2, P3_3 or P5_4
+ * @param hz          Frequency, e.g. 440
+ * @param duration_ms Length in ms, 0 to play until noTone()
+ * @return Frequency actually generated, 0 on failure (see clockOut())
+ *
+ * Always uses the Timer0 path, also on P5_4, so it needs the tick on
+ * Timer2 (Tools > Tick Timer > Timer2). With the default Timer0 tick a
+ * tone() call does not compile ("tone_needs_tick_timer_2" undeclared)
+ * instead of silently returning 0.
+ *
+ * Returns at once: the millis() tick ends a timed tone, drives the pin
+ * LOW and stops and releases Timer0, nothing else runs on the CPU while
+ * it plays. An untimed tone keeps Timer0 until noTone().
+ */
+#if TICK_TIMER == 2
+uint32_t tone(uint8_t pin, uint32_t hz, uint16_t duration_ms);
+#else
+#define tone(pin, hz, duration_ms) tone_needs_tick_timer_2  // Deliberately undeclared
+#endif
+
+/**
+ * @brief Stop a tone or clockOut() output, drive the pin LOW and give
+ *        Timer0 back
+ */
+void noTone(uint8_t pin);
+
+#endif // CLOCK_OUT_H
@@ -0,0 +1,69 @@
+#ifndef DEBOUNCE_H
+#define DEBOUNCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Debounce for buttons on any pins, sampled from the spare timer. Each
+// tick reads P3 and P5 once and runs a 2-bit vertical counter over all
+// six pins in parallel: a pin changes state after 4 equal samples in a
+// row, and the cost per tick does not depend on the number of buttons.
+//
+// Buttons switch the pin to GND; the internal pull-ups are enabled.
+// Changes are posted as EVENT_SOURCE_BUTTON events:
+//   data0 = pins (bit n = Arduino pin n), data1 = DEBOUNCE_PRESS, ...
+
+// Pin mask bit for an Arduino pin
+#define DEBOUNCE_PIN(pin) (1 << (pin))
+
+// Samples per second: 200 gives a 20 ms debounce time
+#define DEBOUNCE_RATE_DEFAULT_HZ 200
+
+// Equal samples needed for a change (2-bit vertical counter)
+#define DEBOUNCE_SAMPLES 4
+
+#define DEBOUNCE_LONG_PRESS_DEFAULT_MS 1000
+
+// Event kinds (Event_t.data1)
+#define DEBOUNCE_PRESS      1
+#define DEBOUNCE_RELEASE    2
+#define DEBOUNCE_LONG_PRESS 3  // Pressed pins unchanged for the long-press time
+
+/**
+ * @brief Start debouncing pins
+ * @param pins    DEBOUNCE_PIN(P3_2) | DEBOUNCE_PIN(P5_4) ...
+ * @param rate_hz Samples per second, e.g. DEBOUNCE_RATE_DEFAULT_HZ
+ * @return false if TIMER_SPARE is taken. The pins are set up anyway,
+ *         so the sketch can call debounceTick() rate_hz times per
+ *         second from its own periodic code.
+ *
+ * Events are posted once a handler is set with
+ * onEvent(EVENT_SOURCE_BUTTON, handler).
+ */
+bool debounceBegin(uint8_t pins, uint16_t rate_hz);
+
+/**
+ * @brief Stop sampling and give the spare timer back
+ */
+void debounceEnd(void);
+
+/**
+ * @brief Time the pressed pins must stay unchanged for DEBOUNCE_LONG_PRESS
+ * @param ms 0 disables long presses (default DEBOUNCE_LONG_PRESS_DEFAULT_MS)
+ *
+ * The time is counted in samples at the rate given to debounceBegin().
+ */
+void debounceLongPress(uint16_t ms);
+
+/**
+ * @brief Debounced pressed pins (bit n = Arduino pin n)
+ */
+uint8_t debounceState(void);
+
+/**
+ * @brief Take one sample; called by the spare timer interrupt
+ */
+void debounceTick(void);
+
+#endif // DEBOUNCE_H
@@ -0,0 +1,80 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Data flash used by the key/value store. The EEPROM area must be at
+// least EEPROM_SECTORS * 512 bytes (set when programming the chip).
+#ifndef EEPROM_BASE
+#define EEPROM_BASE 0x0000
+#endif
+
+// Sectors rotated through for wear leveling (2 or more)
+#ifndef EEPROM_SECTORS
+#define EEPROM_SECTORS 2
+#endif
+
+// Number of keys (0 to EEPROM_KEYS - 1), 4 bytes of XRAM each
+#ifndef EEPROM_KEYS
+#define EEPROM_KEYS 16
+#endif
+
+// Value of a key that was never written
+#define EEPROM_UNSET 0xFFFF
+
+/**
+ * @brief Load the stored values into the RAM cache
+ * @return false if the data flash is not accessible
+ *
+ * Called on first use by the other functions. Formats the store if
+ * no valid sector is found.
+ */
+bool eepromBegin(void);
+
+/**
+ * @brief Read a value from the RAM cache
+ * @return The value, or EEPROM_UNSET if never written
+ */
+uint16_t eepromRead(uint8_t key);
+
+/**
+ * @brief Update a value in the RAM cache
+ * @return false if the key is out of range
+ *
+ * Nothing is written to flash until eepromCommit(). Several updates of
+ * the same key cost a single flash record, and none at all if the
+ * value ends up unchanged.
+ */
+bool eepromWrite(uint8_t key, uint16_t value);
+
+/**
+ * @brief Number of keys whose cached value differs from flash
+ */
+uint8_t eepromPending(void);
+
+/**
+ * @brief Write changed values to flash
+ * @return false if programming failed
+ *
+ * Each changed key appends one 4-byte record to the active sector.
+ * When the sector is full the live values are copied to the next
+ * sector, so erases are spread over all EEPROM_SECTORS.
+ */
+bool eepromCommit(void);
+
+/**
+ * @brief Erase the store and reset all keys to EEPROM_UNSET
+ */
+bool eepromClear(void);
+
+/**
+ * @brief Number of sector rotations since the store was formatted
+ *
+ * Each sector has been erased about eepromGeneration() / EEPROM_SECTORS
+ * times.
+ */
+uint16_t eepromGeneration(void);
+
+#endif // EEPROM_H
@@ -32,4 +32,47 @@ typedef struct {
 // External I2C object
 extern I2C_t Wire;
 
+// Wire methods as plain functions. Wire links every method above;
+// calling these directly links only the ones a sketch uses.
+void wireBegin(void);
+void wireBeginWithPins(I2cPinSelect_t pins);
+void wireEnd(void);
+void wireSetClock(uint32_t frequency) __reentrant;
+uint8_t wireRead(void);
+void wireWrite(uint8_t data);
+void wireBeginTransmission(uint8_t address);
+uint8_t wireEndTransmission(bool sendStop);
+uint8_t wireRequestFrom(uint8_t address, uint8_t quantity, bool sendStop) __reentrant;
+uint8_t wireAvailable(void);
+
+// Async transfer status returned by wirePoll()
+#define WIRE_ASYNC_DONE 0 // Finished (or nothing started)
+#define WIRE_ASYNC_BUSY 1 // Transfer in progress
+#define WIRE_ASYNC_NACK 2 // Address or data byte not acknowledged
+
+/**
+ * @brief Start a non-blocking write
+ * @param data Bytes to send; must stay valid until the transfer ends
+ * @return false if another async transfer is still running
+ *
+ * Drive the transfer with wirePoll(), e.g.
+ *   WAIT_UNTIL(pt, wirePoll() != WIRE_ASYNC_BUSY);
+ */
+bool wireWriteAsync(uint8_t address, const uint8_t *data, uint8_t len, bool sendStop);
+
+/**
+ * @brief Start a non-blocking read into the Wire receive buffer
+ * @return false if another async transfer is still running
+ *
+ * Once wirePoll() returns WIRE_ASYNC_DONE, fetch the bytes with
+ * Wire.available() and Wire.read().
+ */
+bool wireRequestAsync(uint8_t address, uint8_t quantity, bool sendStop);
+
+/**
+ * @brief Advance the current async transfer by at most one bus command
+ * @return WIRE_ASYNC_BUSY until the transfer ends, then its result
+ */
+uint8_t wirePoll(void);
+
 #endif // I2C_H
\ No newline at end of file
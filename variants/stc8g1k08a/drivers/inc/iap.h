@@ -0,0 +1,35 @@
+#ifndef IAP_H
+#define IAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Erase granularity of the data flash
+#define IAP_SECTOR_SIZE 512
+
+/**
+ * @brief Read one byte of data flash (EEPROM area)
+ * @param addr Address relative to the start of the EEPROM area
+ * @return The byte, or 0xFF if the address is outside the EEPROM area
+ */
+uint8_t iapReadByte(uint16_t addr);
+
+/**
+ * @brief Program one byte of data flash
+ * @param addr Address relative to the start of the EEPROM area
+ * @param data Value to program
+ * @return false if the command failed
+ *
+ * Programming can only clear bits. Erase the sector first to write
+ * a value that needs a 0 bit to become 1.
+ */
+bool iapWriteByte(uint16_t addr, uint8_t data);
+
+/**
+ * @brief Erase the 512-byte sector containing addr to 0xFF
+ * @return false if the command failed
+ */
+bool iapEraseSector(uint16_t addr);
+
+#endif // IAP_H
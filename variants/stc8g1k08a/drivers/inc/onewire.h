@@ -0,0 +1,79 @@
+#ifndef ONEWIRE_H
+#define ONEWIRE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// 1-Wire master on any pin, standard speed. Slots are timed from the
+// falling edge against the running tick timer, the same counter that
+// drives millis(), so the timebase keeps counting. Interrupts are off
+// for the timed part of each slot (up to 70 us), and the recovery time
+// between slots runs with interrupts on.
+//
+// The slots need a system clock of at least 1 MHz. Below that,
+// oneWireReset() reports no device and the bit functions leave the bus
+// alone.
+//
+// The pin is driven open-drain with the internal pull-up; add a 4.7k
+// pull-up to VCC for long wires or several devices. Parasite power is
+// not supported: power the devices from VCC.
+
+// ROM commands
+#define ONEWIRE_SEARCH_ROM 0xF0
+#define ONEWIRE_READ_ROM   0x33
+#define ONEWIRE_MATCH_ROM  0x55
+#define ONEWIRE_SKIP_ROM   0xCC
+
+#define ONEWIRE_ROM_SIZE 8  // Family code, 48-bit serial, CRC8
+
+/**
+ * @brief Use pin as the bus and release it (high)
+ */
+void oneWireBegin(uint8_t pin);
+
+/**
+ * @brief Reset pulse, about 1 ms
+ * @return true if at least one device answered with a presence pulse;
+ *         always false below 1 MHz
+ */
+bool oneWireReset(void);
+
+void oneWireWriteBit(bool bit);
+bool oneWireReadBit(void);
+
+/**
+ * @brief Write a byte, LSB first
+ */
+void oneWireWrite(uint8_t byte);
+
+/**
+ * @brief Read a byte, LSB first
+ */
+uint8_t oneWireRead(void);
+
+/**
+ * @brief Address one device (Match ROM) after a reset
+ * @param rom ROM code, or 0 to address every device (Skip ROM)
+ */
+void oneWireSelect(const uint8_t *rom);
+
+/**
+ * @brief Start a new ROM search
+ */
+void oneWireResetSearch(void);
+
+/**
+ * @brief Find the next device on the bus
+ * @param rom Receives the 8-byte ROM code
+ * @return false when no more devices answer or a ROM fails its CRC8;
+ *         call oneWireResetSearch() to start over
+ *
+ * Example:
+ *   uint8_t rom[ONEWIRE_ROM_SIZE];
+ *   oneWireResetSearch();
+ *   while (oneWireSearch(rom)) { ... }
+ */
+bool oneWireSearch(uint8_t *rom);
+
+#endif // ONEWIRE_H
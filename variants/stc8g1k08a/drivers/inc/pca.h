@@ -0,0 +1,239 @@
+#ifndef PCA_H
+#define PCA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// PCA counter clock source (shared by all PCA modules)
+// Values are the CMOD CPS field (bits 3:1)
+typedef enum {
+    PCA_CLOCK_SYSCLK_DIV12 = 0x00, // SYSclk/12 (default)
+    PCA_CLOCK_SYSCLK_DIV2  = 0x02, // SYSclk/2
+    PCA_CLOCK_TIMER0       = 0x04, // Timer0 overflow rate
+    PCA_CLOCK_ECI          = 0x06, // External clock on ECI (P5.5)
+    PCA_CLOCK_SYSCLK       = 0x08, // SYSclk
+    PCA_CLOCK_SYSCLK_DIV4  = 0x0A, // SYSclk/4
+    PCA_CLOCK_SYSCLK_DIV6  = 0x0C, // SYSclk/6
+    PCA_CLOCK_SYSCLK_DIV8  = 0x0E  // SYSclk/8
+} PcaClock_t;
+
+// PWM resolutions supported by the PCA modules
+#define PWM_RESOLUTION_6BIT  6
+#define PWM_RESOLUTION_7BIT  7
+#define PWM_RESOLUTION_8BIT  8   // Default
+#define PWM_RESOLUTION_10BIT 10
+
+// Returned by pca_pin_to_channel() for pins without a CCP output
+#define PCA_NO_CHANNEL 0xFF
+
+// Number of PCA modules
+#define PCA_CHANNELS 3
+
+/**
+ * @brief Output a hardware PWM waveform on a CCP pin
+ * @param pin  P3_2 (CCP0), P3_3 (CCP1) or P5_4 (CCP2)
+ * @param duty 0 (always LOW) to 2^bits - 1 (always HIGH)
+ *
+ * The waveform is generated entirely by the PCA; no CPU time is used
+ * once a channel is running. Duty updates take effect at the next PWM
+ * period boundary, so the output never shows a partial period.
+ * On pins without a CCP output the pin is driven LOW below half scale
+ * and HIGH above it.
+ */
+void analogWrite(uint8_t pin, uint16_t duty);
+
+/**
+ * @brief Stop PWM on a CCP pin and drive it LOW
+ */
+void analogWriteStop(uint8_t pin);
+
+/**
+ * @brief Select the PWM resolution used by subsequent analogWrite() calls
+ * @param bits PWM_RESOLUTION_6BIT, _7BIT, _8BIT or _10BIT
+ */
+void analogWriteResolution(uint8_t bits);
+
+/**
+ * @brief Select the PCA counter clock, which sets the PWM frequency
+ * @return false while tone()/clockOut() or the pulse counter drive the
+ *         PCA clock; the clock is left unchanged
+ *
+ * PWM frequency = PCA clock / 2^bits. With the default SYSclk/12 and
+ * 8-bit resolution at 11.0592 MHz this is 3.6 kHz.
+ */
+bool analogWriteClock(PcaClock_t clock);
+
+/**
+ * @brief PWM frequency in Hz for the current clock and resolution
+ * @return 0 when the PCA is clocked from Timer0 or the ECI pin
+ */
+uint32_t analogWriteFrequency(void);
+
+// Capture edge selection (values are the CCAPMn CCAPP/CCAPN bits)
+#define CAPTURE_RISING  0x20
+#define CAPTURE_FALLING 0x10
+#define CAPTURE_BOTH    (CAPTURE_RISING | CAPTURE_FALLING)
+
+// Edge timestamp recorded by the PCA interrupt
+typedef struct {
+    uint8_t channel;   // PCA module (0-2)
+    uint8_t edge;      // CAPTURE_RISING or CAPTURE_FALLING
+    uint32_t ticks;    // PCA counter value extended to 32 bits
+} CaptureEvent_t;
+
+/**
+ * @brief Start timestamping edges on a CCP pin in hardware
+ * @param pin   P3_2 (CCP0), P3_3 (CCP1) or P5_4 (CCP2)
+ * @param edges CAPTURE_RISING, CAPTURE_FALLING or CAPTURE_BOTH
+ * @return false if the pin has no CCP input
+ *
+ * The PCA latches the counter on each edge, so timestamps do not depend
+ * on interrupt latency. Timestamps count the PCA clock (see
+ * analogWriteClock()); PCA_CLOCK_SYSCLK gives a resolution of one system clock.
+ * The pin is switched to INPUT; call enablePullUp() afterwards if needed.
+ */
+bool captureBegin(uint8_t pin, uint8_t edges);
+
+/**
+ * @brief Stop capturing on a CCP pin
+ */
+void captureEnd(uint8_t pin);
+
+/**
+ * @brief Number of edge events waiting in the capture buffer
+ */
+uint8_t captureAvailable(void);
+
+/**
+ * @brief Take the oldest edge event from the capture buffer
+ * @return false if the buffer is empty
+ */
+bool captureRead(CaptureEvent_t *event);
+
+/**
+ * @brief Number of events dropped because the capture buffer was full
+ */
+uint8_t captureDropped(void);
+
+/**
+ * @brief Last rising-to-rising period in PCA ticks (0 until measured)
+ */
+uint32_t capturePeriod(uint8_t pin);
+
+/**
+ * @brief Last HIGH pulse width in PCA ticks (0 until measured)
+ */
+uint32_t captureHighTime(uint8_t pin);
+
+/**
+ * @brief Signal frequency in Hz from the last period (0 until measured)
+ */
+uint32_t captureFrequency(uint8_t pin);
+
+/**
+ * @brief Duty cycle of the last period in tenths of a percent (0-1000)
+ */
+uint16_t captureDutyCycle(uint8_t pin);
+
+/**
+ * @brief Convert PCA ticks to microseconds
+ */
+uint32_t captureTicksToMicros(uint32_t ticks);
+
+/**
+ * @brief Measure a pulse width in microseconds
+ * @param pin     Pin to measure
+ * @param state   HIGH or LOW pulse
+ * @param timeout Microseconds to wait for the pulse to start and end
+ * @return Pulse width in microseconds, 0 on timeout
+ *
+ * On CCP pins the edges are timestamped by the PCA (captured on both
+ * edges while waiting); other pins, and CCP pins running analogWrite(),
+ * fall back to polling with micros().
+ */
+uint32_t pulseIn(uint8_t pin, uint8_t state, uint32_t timeout);
+
+// Pulse counter input (PCA ECI)
+#define COUNTER_PIN P5_5
+
+// Gate of counterFrequency() in ms
+#define COUNTER_GATE_DEFAULT_MS 1000
+#define COUNTER_GATE_MAX_MS     4000
+
+/**
+ * @brief Count pulses on P5_5 in hardware
+ *
+ * The 8-pin package has no T0/T1 count inputs, so the PCA counter is
+ * clocked from its ECI input instead. Edges are counted by the PCA
+ * itself, up to about SYSclk/2, and only every 65536th pulse raises an
+ * interrupt (to extend the count to 32 bits).
+ *
+ * The PCA counter is shared: while counting, analogWrite() on the CCP
+ * pins runs from the input signal and capture is not usable. The
+ * previous PCA clock is restored by counterEnd(). The pin is switched
+ * to INPUT; call enablePullUp() afterwards for open-collector sensors.
+ *
+ * @return false if tone()/clockOut() drives the PCA clock. A second
+ *         call while counting restarts the count.
+ */
+bool counterBegin(void);
+
+/**
+ * @brief Stop counting and give the PCA its previous clock back
+ */
+void counterEnd(void);
+
+/**
+ * @brief Pulses counted since counterBegin() or counterClear()
+ *
+ * Wraps after 2^32 pulses; differences stay correct across the wrap.
+ */
+uint32_t counterRead(void);
+
+/**
+ * @brief Restart the pulse total and the frequency gate
+ */
+void counterClear(void);
+
+/**
+ * @brief Set the gate time of counterFrequency()
+ * @param ms 1 to COUNTER_GATE_MAX_MS (default COUNTER_GATE_DEFAULT_MS)
+ *
+ * Longer gates give a finer resolution: 1 Hz at 1000 ms, 10 Hz at 100 ms.
+ */
+void counterGate(uint16_t ms);
+
+/**
+ * @brief Input frequency in Hz over the last complete gate
+ * @return 0 until the first gate has completed
+ *
+ * Non-blocking: a call after the gate time has passed closes the gate
+ * against micros() and opens the next one, so call it at least once
+ * per gate (e.g. every loop()). A gate left open for longer than
+ * COUNTER_GATE_MAX_MS is discarded.
+ */
+uint32_t counterFrequency(void);
+
+// Drivers that take the PCA clock over (pca_claim_clock())
+#define PCA_CLOCK_OWNER_FREE      0
+#define PCA_CLOCK_OWNER_CLOCK_OUT 1 // tone()/clockOut(): Timer0 overflows
+#define PCA_CLOCK_OWNER_COUNTER   2 // Pulse counter: ECI input
+
+// Shared PCA helpers used by the PWM and capture drivers
+void pca_start(void);
+void pca_set_clock(PcaClock_t clock);
+PcaClock_t pca_get_clock(void);
+
+// Take the PCA clock over, like timerClaim(). Returns false if another
+// owner has it. pca_release_clock() restores the clock in use before the
+// first claim; it is ignored unless owner holds the clock.
+bool pca_claim_clock(uint8_t owner, PcaClock_t clock);
+void pca_release_clock(uint8_t owner);
+uint8_t pca_clock_owner(void);
+uint32_t pca_clock_hz(void);
+uint8_t pca_pin_to_channel(uint8_t pin);
+uint32_t pca_count(void);     // capture.c
+bool pca_capturing(void);     // capture.c
+
+#endif // PCA_H
@@ -0,0 +1,46 @@
+#ifndef SLEEP_H
+#define SLEEP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Wake-up timer clock (internal ~32 kHz IRC). Override with the value
+// measured on the chip for more accurate millis() after sleeping.
+#ifndef SLEEP_WKT_HZ
+#define SLEEP_WKT_HZ 32000UL
+#endif
+
+// The wake-up timer counts every 16 clocks and holds 15 bits
+#define SLEEP_WKT_MAX_COUNTS 32768UL
+
+// Longest sleep per wake-up timer run: 8 s is SLEEP_WKT_HZ / 2 counts,
+// which fits up to SLEEP_WKT_HZ = 65536
+#define SLEEP_WKT_CHUNK_MS 8000UL
+
+#if SLEEP_WKT_HZ > 65536UL
+#error "SLEEP_WKT_HZ is out of range"
+#endif
+
+/**
+ * @brief Power down for a number of milliseconds
+ * @param ms Time to sleep
+ * @return Milliseconds actually slept (less than ms after an early wake-up)
+ *
+ * Stops the CPU and all clocks, wakes up on the power-down wake-up
+ * timer and credits millis() with the time slept. Enabled INT0-INT4
+ * pins and UART1 RX (Serial.begin()) end the sleep early; the UART
+ * byte that wakes the chip is lost. The time is rounded up to the
+ * resolution of 16 / SLEEP_WKT_HZ (0.5 ms), so a sleep ended by the
+ * timer is never short; accuracy follows the internal 32 kHz oscillator.
+ */
+uint32_t sleepFor(uint32_t ms);
+
+/**
+ * @brief Power down until an enabled interrupt pin or UART RX wakes the chip
+ *
+ * millis() does not advance while powered down.
+ */
+void powerDown(void);
+
+#endif // SLEEP_H
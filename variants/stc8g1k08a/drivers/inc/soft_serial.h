@@ -0,0 +1,73 @@
+#ifndef SOFT_SERIAL_H
+#define SOFT_SERIAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Arduino.h"
+
+// Second serial port in software, 8N1. TIMER_SPARE interrupts at 3x the
+// baud rate: TX shifts a bit out every third tick, RX samples the middle
+// of each bit. The start bit is caught by the falling-edge interrupt of
+// the RX pin, so RX must be an INTx pin: P3_2, P3_3, P5_4, P5_5 or P3_0.
+// Any pin can be TX.
+
+#define SOFT_SERIAL_RX_BUFFER_SIZE 32  // Must be a power of two
+#define SOFT_SERIAL_TX_BUFFER_SIZE 16  // Must be a power of two
+
+// Fewest system clocks between timer ticks; higher baud rates are refused
+#define SOFT_SERIAL_MIN_TICK_CLOCKS 384
+
+// Software serial interface, same shape as Serial_t
+typedef struct {
+    bool (*begin)(uint8_t rx_pin, uint8_t tx_pin, uint32_t baud);
+    void (*end)(void);
+    uint8_t (*available)(void);
+    int (*read)(void);
+    void (*write)(uint8_t byte);
+    void (*print)(const char *str);
+    void (*println)(const char *str);
+    void (*printNumber)(int32_t num) __reentrant;
+} SoftSerial_t;
+
+// External SoftSerial object
+extern SoftSerial_t SoftSerial;
+
+/**
+ * @brief Claim TIMER_SPARE and start the port
+ * @param rx_pin INTx pin (P3_2, P3_3, P5_4, P5_5 or P3_0)
+ * @param tx_pin Any pin; driven high while idle
+ * @param baud Up to getSystemClock() / (3 * SOFT_SERIAL_MIN_TICK_CLOCKS)
+ * @return false if rx_pin has no external interrupt, the spare timer
+ *         is taken, or the baud rate is too high for the clock
+ */
+bool softSerialBegin(uint8_t rx_pin, uint8_t tx_pin, uint32_t baud);
+
+/**
+ * @brief Stop the port, release the timer and the RX interrupt
+ *
+ * Bytes still waiting in the TX buffer are dropped.
+ */
+void softSerialEnd(void);
+
+uint8_t softSerialAvailable(void);
+
+/**
+ * @brief Next received byte, or -1 if none
+ */
+int softSerialRead(void);
+
+/**
+ * @brief Queue a byte; waits only while the TX buffer is full
+ */
+void softSerialWrite(uint8_t byte);
+
+void softSerialPrint(const char *str);
+void softSerialPrintln(const char *str);
+void softSerialPrintNumber(int32_t num) __reentrant;
+
+/**
+ * @brief Bytes lost to a full RX buffer or a missing stop bit since begin
+ */
+uint8_t softSerialErrors(void);
+
+#endif // SOFT_SERIAL_H
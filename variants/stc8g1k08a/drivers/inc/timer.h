@@ -2,8 +2,128 @@
 #define TIMER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "Arduino.h"
 
+// Timer driving millis()/micros() and the delays: 0 (default) or 2.
+// Set through the "Tick Timer" board menu; choose Timer2 when the
+// sketch needs Timer0 itself.
+#ifndef TICK_TIMER
+#define TICK_TIMER 0
+#endif
+
+#if TICK_TIMER != 0 && TICK_TIMER != 2
+#error "TICK_TIMER must be 0 or 2 (Timer1 is the UART1 baud rate generator)"
+#endif
+
+// Timers
+#define TIMER_0 0
+#define TIMER_1 1
+#define TIMER_2 2
+#define TIMER_COUNT 3
+
+// Timer left over by the tick, used by drivers that need a periodic interrupt
+#if TICK_TIMER == 2
+#define TIMER_SPARE TIMER_0
+#else
+#define TIMER_SPARE TIMER_2
+#endif
+
+// Timer owners
+#define TIMER_OWNER_FREE   0
+#define TIMER_OWNER_TICK   1 // millis()/micros()/delays
+#define TIMER_OWNER_SERIAL 2 // UART1 baud rate (Timer1)
+#define TIMER_OWNER_ADC    3 // Continuous ADC pacing
+#define TIMER_OWNER_SOFT_SERIAL 4 // Software UART bit clock
+#define TIMER_OWNER_CLOCK_OUT 5 // tone()/clockOut() PCA clock (Timer0)
+#define TIMER_OWNER_DEBOUNCE 6 // Button sampling
+#define TIMER_OWNER_USER   8 // First owner ID free for sketches and libraries
+
+// Periodic timer callback, runs in interrupt context
+typedef void (*TimerHandler_t)(void);
+
+/**
+ * @brief Take ownership of a timer
+ * @param timer TIMER_0, TIMER_1 or TIMER_2
+ * @param owner TIMER_OWNER_* ID of the caller
+ * @return true if the timer was free or already owned by owner;
+ *         false if another owner has it (counted by timerConflicts())
+ */
+bool timerClaim(uint8_t timer, uint8_t owner);
+
+/**
+ * @brief Give a timer back; ignored unless owner holds it
+ */
+void timerRelease(uint8_t timer, uint8_t owner);
+
+/**
+ * @brief Current owner of a timer (TIMER_OWNER_FREE if unclaimed)
+ */
+uint8_t timerOwner(uint8_t timer);
+
+/**
+ * @brief Number of refused claims since reset
+ *
+ * Non-zero means two drivers wanted the same timer and one of them
+ * is not running.
+ */
+uint8_t timerConflicts(void);
+
+/**
+ * @brief Run handler rate_hz times per second from the timer interrupt
+ * @param timer Claimed timer; only TIMER_SPARE has an interrupt to dispatch
+ * @return false if the timer is not claimed, has no interrupt, or the
+ *         rate cannot be generated at the current clock
+ *
+ * The period is recomputed after setClockDivider().
+ */
+bool timerStartPeriodic(uint8_t timer, uint32_t rate_hz, TimerHandler_t handler);
+
+/**
+ * @brief Stop a timer started with timerStartPeriodic()
+ */
+void timerStop(uint8_t timer);
+
+// Millisecond counter behind millis(); ISRs may read it directly,
+// other code must use millis()
+extern volatile MEM_WARM uint32_t _millis;
+
+/**
+ * @brief Busy-wait for a number of system clock cycles
+ *
+ * Polls the running tick timer, so millis() keeps counting.
+ */
+void delay_cycles(uint32_t cycles);
+
+/**
+ * @brief Current value of the running tick counter
+ *
+ * Counts system clock cycles up from the reload value and wraps once
+ * per millisecond. Start point for delay_cycles_since(); the tick must
+ * already be running (call millis() or micros() first).
+ */
+uint16_t tick_read(void);
+
+/**
+ * @brief Busy-wait until cycles have passed since a tick_read() value
+ * @param cycles Well under one tick period (getSystemClock() / 1000):
+ *               the counter must be polled between cycles and the
+ *               next pass of start, or the wait misses its end
+ *
+ * Timing from a stamp taken before the work, e.g. driving a pin, keeps
+ * that work inside the interval.
+ */
+void delay_cycles_since(uint16_t start, uint16_t cycles);
+
+/**
+ * @brief Busy-wait for a number of microseconds
+ *
+ * Converts with the cycles per microsecond (x 256, rounded up) cached
+ * at the last clock change, so it stays exact below 1 MHz after
+ * setClockDivider(), then calls delay_cycles().
+ */
+void delay_cycles_us(uint32_t us);
+
 // Timer0 register bit positions
 #define TR0_BIT   4  // Timer0 run control bit in TCON
 #define TF0_BIT   5  // Timer0 overflow flag bit in TCON
@@ -18,7 +138,7 @@
  * @brief Initialize Timer0 in Mode 1 (16-bit non-auto-reload)
  * 
  * Configures Timer0 for precision timing with 1T mode (1 count per clock cycle).
- * Stops the timer and prepares it for delay operations.
+ * Only for sketches that own Timer0 (TICK_TIMER = 2, timerClaim(TIMER_0, ...)).
  */
 #define timer0_init() do { \
     CLEAR_BIT(TCON, TR0_BIT); \
@@ -31,67 +151,37 @@
 
 /**
  * @brief Delay for specified microseconds (blocking)
- * @param us Microseconds to delay (1 to 4294967295)
+ * @param us Microseconds to delay (0 to 4294967295)
  * 
- * Uses Timer0 in Mode 1 (16-bit) for accurate microsecond delays.
- * Automatically handles delays longer than the 16-bit timer capacity
- * by breaking them into multiple iterations.
+ * Counts cycles on the running tick timer, so millis() and micros()
+ * keep running and no extra timer is used. The call, the conversion
+ * and the first timer read are added to the delay; at low clock
+ * speeds they dominate delays of a few microseconds. The conversion
+ * rounds up, so the delay is never shorter than requested.
  * 
  * Example:
  *   delay_us(100);    // Delay 100 microseconds
  *   delay_us(5000);   // Delay 5 milliseconds
  */
-#define delay_us(us) do { \
-    uint16_t _reload_value; \
-    uint32_t _cycles_needed; \
-    uint16_t _cycles_this_iteration; \
-    if ((us) != 0) { \
-        _cycles_needed = ((us) * (F_CPU / 1000000UL)); \
-        timer0_init(); \
-        while (_cycles_needed > 0) { \
-            if (_cycles_needed > 65535UL) { \
-                _cycles_this_iteration = 65535; \
-            } else { \
-                _cycles_this_iteration = (uint16_t)_cycles_needed; \
-            } \
-            _reload_value = 65536UL - _cycles_this_iteration; \
-            TL0 = LOW_BYTE(_reload_value); \
-            TH0 = HIGH_BYTE(_reload_value); \
-            CLEAR_BIT(TCON, TF0_BIT); \
-            SET_BIT(TCON, TR0_BIT); \
-            while (!IS_BIT_SET(TCON, TF0_BIT)); \
-            CLEAR_BIT(TCON, TR0_BIT); \
-            _cycles_needed -= _cycles_this_iteration; \
-        } \
-    } \
-} while(0)
+#define delay_us(us) delay_cycles_us(us)
 
 /**
  * @brief Delay for specified milliseconds (blocking)
  * @param ms Milliseconds to delay (1 to 65535)
  * 
- * Optimized to reduce loop overhead by using larger timer periods.
- * Each millisecond is timed using Timer0 with 1ms reload value.
+ * Waits one millisecond worth of tick timer cycles per iteration.
  * 
  * Example:
  *   delay_ms(100);   // Delay 100 milliseconds
  *   delay_ms(1000);  // Delay 1 second
  */
 #define delay_ms(ms) do { \
-    uint16_t _reload_value; \
     uint16_t _i; \
     uint32_t _cycles_per_ms; \
     if ((ms) != 0) { \
-        _cycles_per_ms = F_CPU / 1000UL; \
-        _reload_value = 65536UL - _cycles_per_ms; \
-        timer0_init(); \
+        _cycles_per_ms = getSystemClock() / 1000UL; \
         for (_i = 0; _i < (ms); _i++) { \
-            TL0 = LOW_BYTE(_reload_value); \
-            TH0 = HIGH_BYTE(_reload_value); \
-            CLEAR_BIT(TCON, TF0_BIT); \
-            SET_BIT(TCON, TR0_BIT); \
-            while (!IS_BIT_SET(TCON, TF0_BIT)); \
-            CLEAR_BIT(TCON, TR0_BIT); \
+            delay_cycles(_cycles_per_ms); \
         } \
     } \
 } while(0)
@@ -0,0 +1,159 @@
+#include "adc_private.h"
+
+// Filtered result ring - filled by adc_isr, drained by analogContinuousRead().
+// Single producer/single consumer, so head and tail need no locking.
+#define ADC_BUFFER_SIZE 16  // Must be a power of two
+static volatile MEM_RING uint16_t adc_buffer[ADC_BUFFER_SIZE];
+static volatile MEM_HOT uint8_t adc_head = 0;
+static volatile MEM_HOT uint8_t adc_tail = 0;
+static volatile MEM_WARM uint8_t adc_dropped = 0;
+
+// Continuous mode state
+static volatile MEM_WARM uint8_t adc_start_cmd = 0;        // ADC_CONTR value starting a conversion
+static volatile MEM_WARM bool adc_free_running = false;
+static volatile MEM_WARM uint8_t adc_os_bits = 0;          // Oversampling extra bits
+static volatile MEM_WARM uint8_t adc_os_count = 1;         // Conversions left in this group
+static volatile MEM_WARM uint16_t adc_os_sum = 0;
+static volatile MEM_WARM uint8_t adc_avg_shift = 0;
+static volatile MEM_WARM bool adc_avg_primed = false;
+static volatile MEM_WARM uint32_t adc_avg_acc = 0;         // Running average scaled by 2^shift
+
+void adc_isr(void) __interrupt(5)
+{
+    uint16_t value;
+
+    ADC_CONTR &= ~ADC_FLAG;
+    value = ((uint16_t)(ADC_RES & MASK_TWO_BITS_HIGH) << 8) | ADC_RESL;
+
+    // Result is latched, start the next conversion straight away
+    if (adc_free_running) {
+        ADC_CONTR = adc_start_cmd;
+    }
+
+    // Oversampling: sum 4^bits conversions, keep bits of extra resolution
+    adc_os_sum += value;
+    if (--adc_os_count) {
+        return;
+    }
+    value = adc_os_sum >> adc_os_bits;
+    adc_os_sum = 0;
+    adc_os_count = (uint8_t)(1 << (adc_os_bits << 1));
+
+    // Running average: acc += x - acc / 2^shift
+    if (adc_avg_shift) {
+        if (!adc_avg_primed) {
+            adc_avg_acc = (uint32_t)value << adc_avg_shift;
+            adc_avg_primed = true;
+        } else {
+            // Decay before adding, so a constant x settles at x * 2^shift
+            adc_avg_acc -= adc_avg_acc >> adc_avg_shift;
+            adc_avg_acc += value;
+        }
+        value = (uint16_t)(adc_avg_acc >> adc_avg_shift);
+    }
+
+    adc_latest = value;
+
+    if (((adc_head + 1) & (ADC_BUFFER_SIZE - 1)) != adc_tail) {
+        adc_buffer[adc_head] = value;
+        adc_head = (adc_head + 1) & (ADC_BUFFER_SIZE - 1);
+    } else {
+        adc_dropped++;
+    }
+}
+
+// Spare timer callback pacing conversions in continuous mode
+static void adc_pacing_tick(void)
+{
+    ADC_CONTR = adc_start_cmd;
+}
+
+bool analogContinuousBegin(uint8_t pin, uint16_t rate_hz) {
+    analogContinuousEnd();
+    adc_pin_analog(pin);
+    adc_power_on();
+
+    CLEAR_BIT(IE, 7);  // EA = 0 while the ISR state is reset
+    adc_start_cmd = ADC_POWER | ADC_START | (pin & ADC_CHS_MASK);
+    adc_os_sum = 0;
+    adc_os_count = (uint8_t)(1 << (adc_os_bits << 1));
+    adc_avg_primed = false;
+    adc_head = 0;
+    adc_tail = 0;
+    adc_dropped = 0;
+    adc_free_running = (rate_hz == ADC_FREE_RUNNING);
+    SET_BIT(IE, 7);  // EA = 1
+
+    if (!adc_free_running) {
+        if (!timerClaim(TIMER_SPARE, TIMER_OWNER_ADC)) {
+            return false;
+        }
+        if (!timerStartPeriodic(TIMER_SPARE, rate_hz, adc_pacing_tick)) {
+            timerRelease(TIMER_SPARE, TIMER_OWNER_ADC);
+            return false;
+        }
+    }
+
+    adc_continuous = true;
+    SET_BIT(IE, 5);  // EADC = 1
+
+    if (adc_free_running) {
+        ADC_CONTR = adc_start_cmd;
+    }
+    return true;
+}
+
+void analogContinuousFilter(uint8_t oversample_bits, uint8_t average_shift) {
+    if (oversample_bits > ADC_MAX_OVERSAMPLE_BITS) {
+        oversample_bits = ADC_MAX_OVERSAMPLE_BITS;
+    }
+    if (average_shift > ADC_MAX_AVERAGE_SHIFT) {
+        average_shift = ADC_MAX_AVERAGE_SHIFT;
+    }
+
+    CLEAR_BIT(IE, 5);  // EADC = 0 while the filter is reconfigured
+    adc_os_bits = oversample_bits;
+    adc_os_sum = 0;
+    adc_os_count = (uint8_t)(1 << (oversample_bits << 1));
+    adc_avg_shift = average_shift;
+    adc_avg_primed = false;
+    if (adc_continuous) SET_BIT(IE, 5);
+}
+
+void analogContinuousEnd(void) {
+    if (!adc_continuous) {
+        return;
+    }
+
+    // Stop pacing and the ADC interrupt
+    if (!adc_free_running) {
+        timerRelease(TIMER_SPARE, TIMER_OWNER_ADC);
+    }
+    CLEAR_BIT(IE, 5);  // EADC = 0
+
+    adc_continuous = false;
+    adc_free_running = false;
+
+    // Keep the ADC powered for analogRead(), drop any pending result
+    ADC_CONTR = ADC_POWER;
+}
+
+uint8_t analogContinuousAvailable(void) {
+    return (adc_head - adc_tail) & (ADC_BUFFER_SIZE - 1);
+}
+
+uint16_t analogContinuousRead(void) {
+    uint16_t value;
+
+    if (adc_head == adc_tail) {
+        return analogContinuousLatest();
+    }
+
+    value = adc_buffer[adc_tail];
+    adc_tail = (adc_tail + 1) & (ADC_BUFFER_SIZE - 1);
+    return value;
+}
+
+uint8_t analogContinuousDropped(void) {
+    return adc_dropped;
+}
@@ -0,0 +1,16 @@
+#ifndef ADC_PRIVATE_H
+#define ADC_PRIVATE_H
+
+#include "Arduino.h"
+
+// analogRead() and continuous mode live in separate files so sketches
+// that only call analogRead() do not link adc_isr and its ring buffer.
+
+// Continuous mode status and latest filtered value (adc_read.c)
+extern volatile MEM_WARM bool adc_continuous;
+extern volatile MEM_WARM uint16_t adc_latest;
+
+void adc_pin_analog(uint8_t pin);
+void adc_power_on(void);
+
+#endif // ADC_PRIVATE_H
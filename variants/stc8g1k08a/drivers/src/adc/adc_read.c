@@ -0,0 +1,72 @@
+#include "adc_private.h"
+
+// Slowest ADC clock for the most accurate conversions
+#define ADC_SPEED_DEFAULT 0x0F
+
+// Shared with the continuous mode ISR
+volatile MEM_WARM bool adc_continuous = false;
+volatile MEM_WARM uint16_t adc_latest = 0;
+
+// Switch a pin to high-impedance input with the digital input buffer off
+void adc_pin_analog(uint8_t pin) {
+    uint8_t mask = GET_MASK(pin);
+    uint8_t xfr_backup = P_SW2 & EAXFR;
+
+    if (pin > P5_5) {
+        return;  // Internal channel
+    }
+
+    ENABLE_XFR();
+    if (GET_PORT(pin) == PORT3) {
+        P3M1 |= mask;
+        P3M0 &= ~mask;
+        P3PU &= ~mask;
+        P3IE &= ~mask;
+    } else {
+        P5M1 |= mask;
+        P5M0 &= ~mask;
+        P5PU &= ~mask;
+        P5IE &= ~mask;
+    }
+    if (!xfr_backup) DISABLE_XFR();
+}
+
+// Power the ADC up and let it settle before the first conversion
+void adc_power_on(void) {
+    uint32_t start;
+
+    if (ADC_CONTR & ADC_POWER) {
+        return;
+    }
+
+    ADCCFG = ADC_RESFMT | ADC_SPEED_DEFAULT;
+    ADC_CONTR = ADC_POWER;
+
+    start = micros();
+    while (micros() - start < 1000);
+}
+
+uint16_t analogRead(uint8_t pin) {
+    if (adc_continuous) {
+        return analogContinuousLatest();
+    }
+
+    adc_pin_analog(pin);
+    adc_power_on();
+
+    ADC_CONTR = ADC_POWER | ADC_START | (pin & ADC_CHS_MASK);
+    while (!(ADC_CONTR & ADC_FLAG));
+    ADC_CONTR &= ~ADC_FLAG;
+
+    return ((uint16_t)(ADC_RES & MASK_TWO_BITS_HIGH) << 8) | ADC_RESL;
+}
+
+uint16_t analogContinuousLatest(void) {
+    uint16_t value;
+
+    CLEAR_BIT(IE, 5);  // EADC = 0 for an atomic 16-bit read
+    value = adc_latest;
+    if (adc_continuous) SET_BIT(IE, 5);
+
+    return value;
+}
@@ -0,0 +1,384 @@
+#include "Arduino.h"
+
+// Edge event ring - filled by pca_isr, drained by captureRead().
+// Single producer/single consumer: only the ISR writes capture_head and
+// only the main loop writes capture_tail, so no locking is needed.
+#define CAPTURE_BUFFER_SIZE 16  // Must be a power of two
+// 96 bytes: too big to share the pdata page with the other rings, so
+// it stays in XRAM in every memory profile
+static volatile __xdata CaptureEvent_t capture_buffer[CAPTURE_BUFFER_SIZE];
+static volatile MEM_HOT uint8_t capture_head = 0;
+static volatile MEM_HOT uint8_t capture_tail = 0;
+static volatile MEM_WARM uint8_t capture_dropped = 0;
+
+// Upper 16 bits of the PCA timestamp, counted on CF
+static volatile MEM_WARM uint16_t pca_overflow_count = 0;
+
+// Latest edge timestamps per module
+static volatile MEM_WARM uint32_t capture_last_rise[PCA_CHANNELS];
+static volatile MEM_WARM uint32_t capture_prev_rise[PCA_CHANNELS];
+static volatile MEM_WARM uint32_t capture_last_fall[PCA_CHANNELS];
+static volatile MEM_WARM uint8_t capture_seen[PCA_CHANNELS];
+
+// capture_seen bits
+#define SEEN_RISE   0x01  // At least one rising edge
+#define SEEN_PERIOD 0x02  // Two rising edges, period is valid
+#define SEEN_FALL   0x04  // At least one falling edge
+
+// Modules capturing (bit n = module n) and modules alternating edges
+static volatile MEM_HOT uint8_t capture_active = 0;
+static volatile MEM_HOT uint8_t capture_alternate = 0;
+
+// Latch one module's capture registers into the ring and per-module state.
+// A capture taken just after the counter wrapped (CF still pending, value
+// in the lower half) belongs to the next overflow period. CF is read
+// again for every capture, since the counter may wrap while the ISR runs.
+#define CAPTURE_HANDLE(ch, ccapm, ccapl, ccaph, ccf) do { \
+    if (CCON & (ccf)) { \
+        uint8_t _mode = ccapm; \
+        uint8_t _edge = _mode & CAPTURE_BOTH; \
+        uint16_t _hi = pca_overflow_count; \
+        uint32_t _ticks; \
+        uint8_t _next; \
+        if ((CCON & PCA_CF) && !(ccaph & 0x80)) _hi++; \
+        _ticks = ((uint32_t)_hi << 16) | ((uint16_t)ccaph << 8) | ccapl; \
+        if (capture_alternate & (1 << (ch))) { \
+            ccapm = _mode ^ CAPTURE_BOTH; /* Arm the opposite edge */ \
+        } \
+        if (_edge & CAPTURE_RISING) { \
+            capture_prev_rise[ch] = capture_last_rise[ch]; \
+            capture_last_rise[ch] = _ticks; \
+            capture_seen[ch] |= (capture_seen[ch] & SEEN_RISE) ? \
+                                (SEEN_RISE | SEEN_PERIOD) : SEEN_RISE; \
+        } else { \
+            capture_last_fall[ch] = _ticks; \
+            capture_seen[ch] |= SEEN_FALL; \
+        } \
+        _next = (capture_head + 1) & (CAPTURE_BUFFER_SIZE - 1); \
+        if (_next != capture_tail) { \
+            capture_buffer[capture_head].channel = (ch); \
+            capture_buffer[capture_head].edge = _edge; \
+            capture_buffer[capture_head].ticks = _ticks; \
+            capture_head = _next; \
+        } else { \
+            capture_dropped++; \
+        } \
+        CCON &= ~(ccf); \
+    } \
+} while(0)
+
+void pca_isr(void) __interrupt(7)
+{
+    CAPTURE_HANDLE(0, CCAPM0, CCAP0L, CCAP0H, PCA_CCF0);
+    CAPTURE_HANDLE(1, CCAPM1, CCAP1L, CCAP1H, PCA_CCF1);
+    CAPTURE_HANDLE(2, CCAPM2, CCAP2L, CCAP2H, PCA_CCF2);
+
+    if (CCON & PCA_CF) {  // Overflow not yet counted
+        pca_overflow_count++;
+        CCON &= ~PCA_CF;
+    }
+}
+
+// 32-bit PCA count: the counter extended by the overflows, also the
+// pulse total of counterRead() when the PCA counts the ECI pin
+uint32_t pca_count(void) {
+    uint8_t ea_backup = IE & 0x80;
+    uint16_t hi;
+    uint8_t h, l;
+
+    CLEAR_BIT(IE, 7);
+    hi = pca_overflow_count;
+    h = CH;
+    l = CL;
+    if (CH != h) {  // CL wrapped between the reads
+        h = CH;
+        l = CL;
+    }
+    if ((CCON & PCA_CF) && !(h & 0x80)) {
+        hi++;  // Wrapped, overflow not counted yet
+    }
+    if (ea_backup) SET_BIT(IE, 7);
+
+    return ((uint32_t)hi << 16) | ((uint16_t)h << 8) | l;
+}
+
+// True while a CCP pin captures, so the overflow interrupt must stay on
+bool pca_capturing(void) {
+    return capture_active != 0;
+}
+
+static void capture_set_mode(uint8_t channel, uint8_t mode) {
+    switch (channel) {
+        case 0:
+            CCAPM0 = mode;
+            CCON &= ~PCA_CCF0;
+            break;
+
+        case 1:
+            CCAPM1 = mode;
+            CCON &= ~PCA_CCF1;
+            break;
+
+        default:
+            CCAPM2 = mode;
+            CCON &= ~PCA_CCF2;
+            break;
+    }
+}
+
+bool captureBegin(uint8_t pin, uint8_t edges) {
+    uint8_t channel = pca_pin_to_channel(pin);
+    uint8_t mask;
+    uint8_t mode;
+
+    if (channel == PCA_NO_CHANNEL || !(edges & CAPTURE_BOTH)) {
+        return false;
+    }
+    mask = 1 << channel;
+
+    pinMode(pin, INPUT);
+
+    CLEAR_BIT(IE, 7);  // EA = 0 while the ISR state is reset
+
+    if ((edges & CAPTURE_BOTH) == CAPTURE_BOTH) {
+        // Arm one edge at a time so every event knows its polarity
+        capture_alternate |= mask;
+        mode = digitalRead(pin) ? CAPTURE_FALLING : CAPTURE_RISING;
+    } else {
+        capture_alternate &= ~mask;
+        mode = edges & CAPTURE_BOTH;
+    }
+
+    capture_last_rise[channel] = 0;
+    capture_prev_rise[channel] = 0;
+    capture_last_fall[channel] = 0;
+    capture_seen[channel] = 0;
+
+    capture_set_mode(channel, mode | PCA_ECCF);
+    capture_active |= mask;
+
+    CMOD |= CMOD_ECF;  // Overflow interrupt extends timestamps to 32 bits
+    pca_start();
+
+    SET_BIT(IE, 7);  // EA = 1
+    return true;
+}
+
+void captureEnd(uint8_t pin) {
+    uint8_t channel = pca_pin_to_channel(pin);
+
+    if (channel == PCA_NO_CHANNEL) {
+        return;
+    }
+
+    capture_set_mode(channel, 0x00);
+    capture_active &= ~(1 << channel);
+    capture_alternate &= ~(1 << channel);
+
+    // The pulse counter needs the overflow interrupt too
+    if (!capture_active && pca_clock_owner() != PCA_CLOCK_OWNER_COUNTER) {
+        CMOD &= ~CMOD_ECF;
+    }
+}
+
+uint8_t captureAvailable(void) {
+    return (capture_head - capture_tail) & (CAPTURE_BUFFER_SIZE - 1);
+}
+
+bool captureRead(CaptureEvent_t *event) {
+    if (capture_head == capture_tail) {
+        return false;
+    }
+
+    event->channel = capture_buffer[capture_tail].channel;
+    event->edge = capture_buffer[capture_tail].edge;
+    event->ticks = capture_buffer[capture_tail].ticks;
+    capture_tail = (capture_tail + 1) & (CAPTURE_BUFFER_SIZE - 1);
+    return true;
+}
+
+uint8_t captureDropped(void) {
+    return capture_dropped;
+}
+
+uint32_t capturePeriod(uint8_t pin) {
+    uint8_t channel = pca_pin_to_channel(pin);
+    uint32_t period;
+
+    if (channel == PCA_NO_CHANNEL) {
+        return 0;
+    }
+
+    CLEAR_BIT(IE, 7);  // EA = 0 to read a consistent pair
+    if (capture_seen[channel] & SEEN_PERIOD) {
+        period = capture_last_rise[channel] - capture_prev_rise[channel];
+    } else {
+        period = 0;
+    }
+    SET_BIT(IE, 7);
+
+    return period;
+}
+
+uint32_t captureHighTime(uint8_t pin) {
+    uint8_t channel = pca_pin_to_channel(pin);
+    uint32_t rise, prev_rise, fall;
+    uint8_t seen;
+
+    if (channel == PCA_NO_CHANNEL) {
+        return 0;
+    }
+
+    CLEAR_BIT(IE, 7);  // EA = 0 to read a consistent set
+    rise = capture_last_rise[channel];
+    prev_rise = capture_prev_rise[channel];
+    fall = capture_last_fall[channel];
+    seen = capture_seen[channel];
+    SET_BIT(IE, 7);
+
+    if (!(seen & SEEN_FALL) || !(seen & SEEN_RISE)) {
+        return 0;
+    }
+
+    // The falling edge ends the pulse that began at the latest rising
+    // edge before it
+    if ((int32_t)(fall - rise) > 0) {
+        return fall - rise;
+    }
+    if ((seen & SEEN_PERIOD) && (int32_t)(fall - prev_rise) > 0) {
+        return fall - prev_rise;
+    }
+    return 0;
+}
+
+uint32_t captureFrequency(uint8_t pin) {
+    uint32_t period = capturePeriod(pin);
+
+    if (period == 0) {
+        return 0;
+    }
+    return (pca_clock_hz() + (period >> 1)) / period;
+}
+
+uint16_t captureDutyCycle(uint8_t pin) {
+    uint32_t period = capturePeriod(pin);
+    uint32_t high = captureHighTime(pin);
+
+    if (period == 0) {
+        return 0;
+    }
+
+    // Scale down so high * 1000 fits in 32 bits
+    while (period > 0x400000UL) {
+        period >>= 1;
+        high >>= 1;
+    }
+    if (high > period) {
+        high = period;
+    }
+    return (uint16_t)((high * 1000UL) / period);
+}
+
+uint32_t captureTicksToMicros(uint32_t ticks) {
+    uint32_t khz = pca_clock_hz() / 1000UL;
+
+    if (khz == 0) {
+        return 0;
+    }
+    // Split the division so ticks * 1000 cannot overflow
+    return (ticks / khz) * 1000UL + ((ticks % khz) * 1000UL) / khz;
+}
+
+// Polling fallback for pins without a CCP input
+static uint32_t pulse_in_polled(uint8_t pin, uint8_t state, uint32_t timeout) {
+    uint32_t start = micros();
+    uint32_t pulse_start;
+
+    while (digitalRead(pin) == state) {  // Let a pulse in progress finish
+        if (micros() - start >= timeout) return 0;
+    }
+    while (digitalRead(pin) != state) {
+        if (micros() - start >= timeout) return 0;
+    }
+    pulse_start = micros();
+    while (digitalRead(pin) == state) {
+        if (micros() - start >= timeout) return 0;
+    }
+    return micros() - pulse_start;
+}
+
+uint32_t pulseIn(uint8_t pin, uint8_t state, uint32_t timeout) {
+    uint8_t channel = pca_pin_to_channel(pin);
+    uint8_t mask;
+    uint8_t mode;
+    uint8_t restore_edges = 0;
+    uint32_t start;
+    uint32_t t_first, t_begin, t_end;
+    uint32_t width = 0;
+    volatile MEM_WARM uint32_t *begin_ts;
+    volatile MEM_WARM uint32_t *end_ts;
+
+    if (channel == PCA_NO_CHANNEL) {
+        return pulse_in_polled(pin, state, timeout);
+    }
+
+    // Capturing would overwrite a running analogWrite() on the module
+    switch (channel) {
+        case 0:  mode = CCAPM0; break;
+        case 1:  mode = CCAPM1; break;
+        default: mode = CCAPM2; break;
+    }
+    if (mode & PCA_PWM) {
+        return pulse_in_polled(pin, state, timeout);
+    }
+    mask = 1 << channel;
+
+    // Capture both edges while measuring, then restore the previous setup
+    if (capture_active & mask) {
+        if (capture_alternate & mask) {
+            restore_edges = CAPTURE_BOTH;
+        } else {
+            switch (channel) {
+                case 0:  restore_edges = CCAPM0 & CAPTURE_BOTH; break;
+                case 1:  restore_edges = CCAPM1 & CAPTURE_BOTH; break;
+                default: restore_edges = CCAPM2 & CAPTURE_BOTH; break;
+            }
+        }
+    }
+    if (restore_edges != CAPTURE_BOTH) {
+        captureBegin(pin, CAPTURE_BOTH);
+    }
+
+    if (state == HIGH) {
+        begin_ts = &capture_last_rise[channel];
+        end_ts = &capture_last_fall[channel];
+    } else {
+        begin_ts = &capture_last_fall[channel];
+        end_ts = &capture_last_rise[channel];
+    }
+
+    // Wait for a new edge starting the pulse, followed by the edge ending it
+    CLEAR_BIT(IE, 7);
+    t_first = *begin_ts;
+    SET_BIT(IE, 7);
+
+    start = micros();
+    while (micros() - start < timeout) {
+        CLEAR_BIT(IE, 7);  // EA = 0 to read a consistent pair
+        t_begin = *begin_ts;
+        t_end = *end_ts;
+        SET_BIT(IE, 7);
+
+        if (t_begin != t_first && (int32_t)(t_end - t_begin) > 0) {
+            width = captureTicksToMicros(t_end - t_begin);
+            break;
+        }
+    }
+
+    if (restore_edges == 0) {
+        captureEnd(pin);
+    } else if (restore_edges != CAPTURE_BOTH) {
+        captureBegin(pin, restore_edges);
+    }
+    return width;
+}
@@ -1,5 +1,12 @@
 #include "Arduino.h"
 
+// Runtime clock state - moved to XRAM to save internal RAM
+static MEM_COLD uint8_t clock_base_divider = 1;  // CLKDIV giving F_CPU
+static MEM_COLD uint8_t clock_divider = 1;
+static MEM_COLD uint32_t clock_hz = F_CPU;
+static MEM_COLD ClockListener_t clock_listeners[CLOCK_MAX_LISTENERS];
+static MEM_COLD uint8_t clock_listener_count = 0;
+
 void clock_init(void)
 {
   // CRITICAL: Enable extended RAM/SFR access
@@ -39,5 +46,65 @@ void clock_init(void)
   CLKDIV = 0x01; // No division (MCLK/1)
 #endif
 
+ // CLKDIV 0 and 1 both mean MCLK/1
+  clock_base_divider = CLKDIV ? CLKDIV : 1;
+  clock_divider = clock_base_divider;
+  clock_hz = F_CPU;
+
  P_SW2 = 0x00;  // <-- CRITICAL! You close the XDATA access
+}
+
+uint32_t getSystemClock(void)
+{
+  return clock_hz;
+}
+
+uint8_t getClockDivider(void)
+{
+  return clock_divider;
+}
+
+bool setClockDivider(uint8_t divider)
+{
+  uint8_t xfr_backup = P_SW2 & EAXFR;
+  uint8_t i;
+
+  if (divider == 0)
+  {
+    return false;
+  }
+
+  ENABLE_XFR();
+  CLKDIV = divider;
+  if (!xfr_backup) DISABLE_XFR();
+
+  clock_divider = divider;
+  clock_hz = (F_CPU * clock_base_divider) / divider;
+
+  // Let the drivers retime themselves
+  for (i = 0; i < clock_listener_count; i++)
+  {
+    clock_listeners[i]();
+  }
+  return true;
+}
+
+bool clockAddListener(ClockListener_t listener)
+{
+  uint8_t i;
+
+  for (i = 0; i < clock_listener_count; i++)
+  {
+    if (clock_listeners[i] == listener)
+    {
+      return true;
+    }
+  }
+
+  if (clock_listener_count >= CLOCK_MAX_LISTENERS)
+  {
+    return false;
+  }
+  clock_listeners[clock_listener_count++] = listener;
+  return true;
 }
\ No newline at end of file
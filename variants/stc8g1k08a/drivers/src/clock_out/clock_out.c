@@ -0,0 +1,308 @@
+#include "clock_out_private.h"
+
+// Output settings, kept to retime the output after a clock change
+static MEM_COLD uint8_t clock_out_pin;
+static MEM_COLD uint32_t clock_out_hz = 0;
+static MEM_COLD bool clock_out_mclko;
+
+#if TICK_TIMER == 2
+// Timer0 path: f = clk / (prescale * 64 * counts), counts = 2 .. 65536.
+// Returns the rounded frequency, or 0 when hz is out of reach.
+static uint32_t timer0_plan(uint32_t clk, uint32_t hz, uint32_t *counts, bool *use_12t)
+{
+    uint32_t n;
+    uint32_t period;
+
+    *use_12t = false;
+    n = (clk + hz * (CLOCK_OUT_PCA_COUNTS / 2)) / (hz * CLOCK_OUT_PCA_COUNTS);
+    if (n > 65536UL) {
+        *use_12t = true;
+        n = (clk + hz * (CLOCK_OUT_PCA_COUNTS * 6)) / (hz * CLOCK_OUT_PCA_COUNTS * 12);
+    }
+    if (n < 2 || n > 65536UL) {
+        return 0;
+    }
+
+    *counts = n;
+    period = n * CLOCK_OUT_PCA_COUNTS * (*use_12t ? 12 : 1);
+    return (clk + (period >> 1)) / period;
+}
+
+// Timer0 mode 0 (16-bit auto-reload) without interrupt: the overflows
+// only clock the PCA
+static void timer0_program(uint32_t counts, bool use_12t)
+{
+    uint16_t reload = (uint16_t)(65536UL - counts);
+
+    CLEAR_BIT(TCON, TR0_BIT);
+    CLEAR_BIT(IE, 1);  // ET0 = 0
+    CLEAR_BIT_MASK(TMOD, 0x0F);
+    if (use_12t) {
+        CLEAR_BIT(AUXR, T0x12_BIT);
+    } else {
+        SET_BIT(AUXR, T0x12_BIT);
+    }
+    TH0 = HIGH_BYTE(reload);
+    TL0 = LOW_BYTE(reload);
+    SET_BIT(TCON, TR0_BIT);
+}
+
+// 6-bit PWM at 50%: LOW while the count is below 32, HIGH above
+static void pca_square(uint8_t channel)
+{
+    uint8_t half = CLOCK_OUT_PCA_COUNTS / 2;
+
+    switch (channel) {
+        case 0:
+            PCA_PWM0 = PCA_EBS_6BIT;
+            CCAP0H = half;
+            CCAP0L = half;
+            CCAPM0 = PCA_ECOM | PCA_PWM;
+            break;
+
+        case 1:
+            PCA_PWM1 = PCA_EBS_6BIT;
+            CCAP1H = half;
+            CCAP1L = half;
+            CCAPM1 = PCA_ECOM | PCA_PWM;
+            break;
+
+        default:
+            PCA_PWM2 = PCA_EBS_6BIT;
+            CCAP2H = half;
+            CCAP2L = half;
+            CCAPM2 = PCA_ECOM | PCA_PWM;
+            break;
+    }
+}
+#endif
+
+// MCLKO path: f = clk / div, div = 1 .. 127
+static uint32_t mclko_plan(uint32_t clk, uint32_t hz, uint8_t *div)
+{
+    uint32_t d = (clk + (hz >> 1)) / hz;
+
+    if (d < 1 || d > CLOCK_OUT_MCLKO_MAX_DIV) {
+        return 0;
+    }
+    *div = (uint8_t)d;
+    return (clk + (d >> 1)) / d;
+}
+
+static void mclko_write(uint8_t div)
+{
+    uint8_t xfr_backup = P_SW2 & EAXFR;
+
+    ENABLE_XFR();
+    MCLKOCR = div;  // MCLKO_S = 0: P5.4
+    if (!xfr_backup) DISABLE_XFR();
+}
+
+static uint32_t error_hz(uint32_t actual, uint32_t hz)
+{
+    return actual > hz ? actual - hz : hz - actual;
+}
+
+static void clock_out_channel_off(void)
+{
+    switch (clock_out_channel) {
+        case 0:
+            CCAPM0 = 0x00;
+            PCA_PWM0 = 0x00;
+            break;
+
+        case 1:
+            CCAPM1 = 0x00;
+            PCA_PWM1 = 0x00;
+            break;
+
+        case 2:
+            CCAPM2 = 0x00;
+            PCA_PWM2 = 0x00;
+            break;
+
+        case CLOCK_OUT_MCLKO:
+            mclko_write(0);
+            break;
+    }
+}
+
+// Keep the frequency after setClockDivider(). Only the clock source is
+// reprogrammed: the PCA module and the time left of a tone() stay as
+// they are, so a tone the tick has ended stays silent.
+static void clock_out_clock_changed(void)
+{
+    uint32_t clk = getSystemClock();
+    uint32_t actual = 0;
+#if TICK_TIMER == 2
+    uint32_t counts;
+    bool use_12t;
+    uint8_t ea_backup;
+#endif
+    uint8_t div;
+
+    if (clock_out_channel == CLOCK_OUT_IDLE) {
+        return;
+    }
+
+    if (clock_out_channel == CLOCK_OUT_MCLKO) {
+        actual = mclko_plan(clk, clock_out_hz, &div);
+        if (actual) {
+            mclko_write(div);
+        }
+    }
+#if TICK_TIMER == 2
+    else if (clock_out_silenced) {
+        return;  // Retimed by the next tone()
+    } else {
+        actual = timer0_plan(clk, clock_out_hz, &counts, &use_12t);
+        if (actual) {
+            // A timed tone may have ended, and Timer0 been released,
+            // while the plan was computed
+            ea_backup = IE & 0x80;
+            CLEAR_BIT(IE, 7);
+            if (clock_out_silenced) {
+                if (ea_backup) SET_BIT(IE, 7);
+                return;
+            }
+            timer0_program(counts, use_12t);
+            if (ea_backup) SET_BIT(IE, 7);
+        }
+    }
+#endif
+
+    if (actual == 0) {
+        clock_out_stop();  // No longer reachable
+    }
+}
+
+uint32_t clock_out_start(uint8_t pin, uint32_t hz, bool mclko)
+{
+    uint32_t clk = getSystemClock();
+    uint8_t channel = pca_pin_to_channel(pin);
+    uint32_t actual = 0;
+    uint8_t ea_backup;
+#if TICK_TIMER == 2
+    uint32_t counts;
+    bool use_12t;
+    uint16_t ms_left;
+#endif
+    uint8_t div = 0;
+    uint32_t mclko_hz = 0;
+
+    if (channel == PCA_NO_CHANNEL || hz == 0 || hz > clk) {
+        return 0;
+    }
+
+#if TICK_TIMER == 2
+    // Hold a running timed tone, so the tick cannot release Timer0
+    // between this claim and the restart below
+    ea_backup = IE & 0x80;
+    CLEAR_BIT(IE, 7);
+    ms_left = clock_out_ms_left;
+    clock_out_ms_left = 0;
+    if (ea_backup) SET_BIT(IE, 7);
+
+    // The PCA clock must be free for Timer0 (the pulse counter uses ECI)
+    if ((pca_clock_owner() == PCA_CLOCK_OWNER_FREE ||
+         pca_clock_owner() == PCA_CLOCK_OWNER_CLOCK_OUT) &&
+        timerClaim(TIMER_0, TIMER_OWNER_CLOCK_OUT)) {
+        actual = timer0_plan(clk, hz, &counts, &use_12t);
+    }
+#endif
+    if (mclko && pin == P5_4) {
+        mclko_hz = mclko_plan(clk, hz, &div);
+    }
+    if (mclko_hz && (actual == 0 || error_hz(mclko_hz, hz) < error_hz(actual, hz))) {
+        actual = mclko_hz;
+        channel = CLOCK_OUT_MCLKO;
+    }
+    if (actual == 0) {
+#if TICK_TIMER == 2
+        if (clock_out_channel >= CLOCK_OUT_MCLKO || clock_out_silenced) {
+            timerRelease(TIMER_0, TIMER_OWNER_CLOCK_OUT);  // Timer0 unused
+        }
+        ea_backup = IE & 0x80;
+        CLEAR_BIT(IE, 7);
+        clock_out_ms_left = ms_left;  // The old tone keeps its end
+        if (ea_backup) SET_BIT(IE, 7);
+#endif
+        return 0;
+    }
+
+    // A timed tone must not end in the middle of the switch
+    ea_backup = IE & 0x80;
+    CLEAR_BIT(IE, 7);
+    clock_out_ms_left = 0;
+    clock_out_silenced = false;
+    if (ea_backup) SET_BIT(IE, 7);
+
+    if (pin != clock_out_pin || channel != clock_out_channel) {
+        clock_out_channel_off();
+        if (clock_out_channel != CLOCK_OUT_IDLE) {
+            digitalWrite(clock_out_pin, LOW);
+        }
+    }
+
+    digitalWrite(pin, LOW);  // Level after the output stops
+    pinMode(pin, OUTPUT);
+
+    if (channel == CLOCK_OUT_MCLKO) {
+        mclko_write(div);
+#if TICK_TIMER == 2
+        timerRelease(TIMER_0, TIMER_OWNER_CLOCK_OUT);
+        CLEAR_BIT(TCON, TR0_BIT);
+#endif
+        pca_release_clock(PCA_CLOCK_OWNER_CLOCK_OUT);
+    }
+#if TICK_TIMER == 2
+    else {
+        timer0_program(counts, use_12t);
+        pca_claim_clock(PCA_CLOCK_OWNER_CLOCK_OUT, PCA_CLOCK_TIMER0);  // Checked above
+        pca_square(channel);
+        pca_start();
+    }
+#endif
+
+    clock_out_pin = pin;
+    clock_out_channel = channel;
+    clock_out_hz = hz;
+    clock_out_mclko = mclko;
+    clockAddListener(clock_out_clock_changed);
+    return actual;
+}
+
+void clock_out_stop(void)
+{
+    uint8_t ea_backup = IE & 0x80;
+
+    CLEAR_BIT(IE, 7);
+    clock_out_ms_left = 0;
+    clock_out_silenced = false;
+    if (ea_backup) SET_BIT(IE, 7);
+
+    if (clock_out_channel == CLOCK_OUT_IDLE) {
+        return;
+    }
+
+    clock_out_channel_off();
+    digitalWrite(clock_out_pin, LOW);
+#if TICK_TIMER == 2
+    if (timerOwner(TIMER_0) == TIMER_OWNER_CLOCK_OUT) {
+        CLEAR_BIT(TCON, TR0_BIT);
+        timerRelease(TIMER_0, TIMER_OWNER_CLOCK_OUT);
+    }
+#endif
+    pca_release_clock(PCA_CLOCK_OWNER_CLOCK_OUT);
+    clock_out_channel = CLOCK_OUT_IDLE;
+    clock_out_hz = 0;
+}
+
+uint32_t clockOut(uint8_t pin, uint32_t hz)
+{
+    if (hz == 0) {
+        clock_out_stop();
+        return 0;
+    }
+    return clock_out_start(pin, hz, true);
+}
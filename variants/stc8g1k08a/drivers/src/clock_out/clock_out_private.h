@@ -0,0 +1,61 @@
+#ifndef CLOCK_OUT_PRIVATE_H
+#define CLOCK_OUT_PRIVATE_H
+
+#include "Arduino.h"
+
+// Shared state of clockOut()/tone(). The variables live in
+// clock_out_state.c so the tick interrupt can reference them without
+// linking the rest of the driver.
+
+// Values of clock_out_channel besides the PCA modules 0-2
+#define CLOCK_OUT_MCLKO 3               // System clock output on P5_4
+#define CLOCK_OUT_IDLE  PCA_NO_CHANNEL
+
+// Output in use, CLOCK_OUT_IDLE when stopped
+extern volatile MEM_HOT uint8_t clock_out_channel;
+
+// Milliseconds left of a timed tone(), counted down by the tick
+// interrupt (micro_millis.c, TICK_TIMER 2 only). 0 = no time limit.
+extern volatile MEM_HOT uint16_t clock_out_ms_left;
+
+// Set by the tick when it ends a timed tone(), cleared by the next start
+extern volatile MEM_HOT bool clock_out_silenced;
+
+extern volatile MEM_COLD uint8_t timer_owner[TIMER_COUNT];  // timers.c
+
+/**
+ * @brief Silence the PCA output from the tick interrupt
+ *
+ * The module is switched off, so the pin falls back to its LOW latch,
+ * and Timer0 is stopped and given back. timerRelease() is not
+ * reentrant, so the claim is cleared directly; Timer0 is never
+ * TIMER_SPARE's periodic timer while tone() owns it. The PCA clock
+ * stays claimed until noTone() or the next tone().
+ */
+#define CLOCK_OUT_SILENCE() do { \
+    clock_out_silenced = true; \
+    if (clock_out_channel == 0) { \
+        CCAPM0 = 0x00; \
+    } else if (clock_out_channel == 1) { \
+        CCAPM1 = 0x00; \
+    } else if (clock_out_channel == 2) { \
+        CCAPM2 = 0x00; \
+    } \
+    if (timer_owner[TIMER_0] == TIMER_OWNER_CLOCK_OUT) { \
+        CLEAR_BIT(TCON, TR0_BIT); \
+        timer_owner[TIMER_0] = TIMER_OWNER_FREE; \
+    } \
+} while(0)
+
+/**
+ * @brief Start the output; see clockOut()
+ * @param mclko Allow the MCLKO path on P5_4
+ */
+uint32_t clock_out_start(uint8_t pin, uint32_t hz, bool mclko);
+
+/**
+ * @brief Stop the output and release Timer0 and the PCA clock
+ */
+void clock_out_stop(void);
+
+#endif // CLOCK_OUT_PRIVATE_H
@@ -0,0 +1,5 @@
+#include "clock_out_private.h"
+
+volatile MEM_HOT uint8_t clock_out_channel = CLOCK_OUT_IDLE;
+volatile MEM_HOT uint16_t clock_out_ms_left = 0;
+volatile MEM_HOT bool clock_out_silenced = false;
@@ -0,0 +1,30 @@
+#include "clock_out_private.h"
+
+#if TICK_TIMER == 2
+uint32_t tone(uint8_t pin, uint32_t hz, uint16_t duration_ms)
+{
+    uint32_t actual = clock_out_start(pin, hz, false);
+    uint8_t ea_backup;
+
+    if (actual && duration_ms) {
+        millis();  // Make sure the tick runs
+
+        ea_backup = IE & 0x80;
+        CLEAR_BIT(IE, 7);  // 16-bit value, read by the tick
+        clock_out_ms_left = duration_ms;
+        if (ea_backup) SET_BIT(IE, 7);
+    }
+    return actual;
+}
+#endif
+// Otherwise Timer0 drives millis() and no timer is left to clock the
+// PCA: clock_out.h turns tone() calls into a compile error
+
+void noTone(uint8_t pin)
+{
+    uint8_t channel = clock_out_channel;
+
+    if (channel == CLOCK_OUT_MCLKO ? pin == P5_4 : pca_pin_to_channel(pin) == channel) {
+        clock_out_stop();
+    }
+}
@@ -0,0 +1,104 @@
+#include "Arduino.h"
+
+// Pulse counter state - kept in XRAM to save internal RAM
+static MEM_COLD bool counter_running = false;
+static MEM_COLD uint32_t counter_base = 0;  // pca_count() at counterClear()
+
+// Frequency gate: PCA count and micros() when the gate opened
+static MEM_COLD uint16_t counter_gate_ms = COUNTER_GATE_DEFAULT_MS;
+static MEM_COLD uint32_t counter_gate_count;
+static MEM_COLD uint32_t counter_gate_us;
+static MEM_COLD uint32_t counter_hz = 0;
+
+// Both snapshots are taken in the same order, so the call time cancels
+static void counter_gate_open(void) {
+    counter_gate_count = pca_count();
+    counter_gate_us = micros();
+}
+
+bool counterBegin(void) {
+    if (counter_running) {
+        counterClear();
+        return true;
+    }
+
+    if (!pca_claim_clock(PCA_CLOCK_OWNER_COUNTER, PCA_CLOCK_ECI)) {
+        return false;
+    }
+
+    pinMode(COUNTER_PIN, INPUT);
+
+    CMOD |= CMOD_ECF;  // Overflow interrupt extends the count to 32 bits
+    pca_start();
+
+    counter_running = true;
+    counterClear();
+    return true;
+}
+
+void counterEnd(void) {
+    if (!counter_running) {
+        return;
+    }
+
+    if (!pca_capturing()) {
+        CMOD &= ~CMOD_ECF;
+    }
+    pca_release_clock(PCA_CLOCK_OWNER_COUNTER);
+    counter_running = false;
+    counter_hz = 0;
+}
+
+uint32_t counterRead(void) {
+    return pca_count() - counter_base;
+}
+
+void counterClear(void) {
+    counter_gate_open();
+    counter_base = counter_gate_count;
+    counter_hz = 0;
+}
+
+void counterGate(uint16_t ms) {
+    if (ms == 0 || ms > COUNTER_GATE_MAX_MS) {
+        return;
+    }
+    counter_gate_ms = ms;
+    counter_gate_open();
+}
+
+uint32_t counterFrequency(void) {
+    uint32_t count;
+    uint32_t now;
+    uint32_t elapsed;
+    uint32_t pulses;
+    uint32_t rem;
+    uint32_t hz;
+
+    if (!counter_running ||
+        micros() - counter_gate_us < (uint32_t)counter_gate_ms * 1000UL) {
+        return counter_hz;
+    }
+
+    count = pca_count();
+    now = micros();
+    elapsed = now - counter_gate_us;
+    pulses = count - counter_gate_count;
+    counter_gate_count = count;
+    counter_gate_us = now;
+
+    if (elapsed > COUNTER_GATE_MAX_MS * 1000UL) {
+        return counter_hz;  // Not polled in time, the next gate starts now
+    }
+
+    // hz = pulses * 1000000 / elapsed, one decimal step of 1000 at a
+    // time so nothing overflows (elapsed < 4.3 s keeps rem * 1000 in range)
+    hz = (pulses / elapsed) * 1000000UL;
+    rem = (pulses % elapsed) * 1000UL;
+    hz += (rem / elapsed) * 1000UL;
+    rem = (rem % elapsed) * 1000UL;
+    hz += (rem + (elapsed >> 1)) / elapsed;
+
+    counter_hz = hz;
+    return hz;
+}
@@ -0,0 +1,117 @@
+#include "Arduino.h"
+
+// Vertical counter state, one bit per Arduino pin. Read and written on
+// every tick, so it lives in MEM_HOT.
+static MEM_HOT uint8_t debounce_mask = 0;   // Pins being debounced
+static MEM_HOT uint8_t debounce_state = 0;  // Debounced level, 1 = pressed
+static MEM_HOT uint8_t debounce_ct0 = 0xFF; // Counter bit 0 per pin
+static MEM_HOT uint8_t debounce_ct1 = 0xFF; // Counter bit 1 per pin
+static MEM_HOT uint16_t debounce_hold = 0;  // Ticks since the last change
+
+// Settings - kept in XRAM to save internal RAM
+static MEM_COLD uint16_t debounce_rate_hz = DEBOUNCE_RATE_DEFAULT_HZ;
+static MEM_COLD uint16_t debounce_long_ms = DEBOUNCE_LONG_PRESS_DEFAULT_MS;
+static MEM_WARM uint16_t debounce_long_ticks = 0;
+
+void debounceTick(void)
+{
+    // One read per port; bit n is Arduino pin n (P3.0-P3.3, P5.4-P5.5)
+    uint8_t sample = (P3 & 0x0F) | (P5 & 0x30);
+    uint8_t changed;
+
+    // Pins whose pressed level (LOW) differs from the debounced state
+    changed = (debounce_state ^ (uint8_t)~sample) & debounce_mask;
+
+    // Count down while a pin differs, reset to 3 when it agrees again
+    debounce_ct0 = ~(debounce_ct0 & changed);
+    debounce_ct1 = debounce_ct0 ^ (debounce_ct1 & changed);
+    changed &= debounce_ct0 & debounce_ct1;  // Differed DEBOUNCE_SAMPLES times
+    debounce_state ^= changed;
+
+    if (changed) {
+        debounce_hold = 0;
+        if (EVENT_WANTED(EVENT_SOURCE_BUTTON)) {
+            if (debounce_state & changed) {
+                EVENT_POST(EVENT_SOURCE_BUTTON, debounce_state & changed, DEBOUNCE_PRESS);
+            }
+            if (~debounce_state & changed) {
+                EVENT_POST(EVENT_SOURCE_BUTTON, ~debounce_state & changed, DEBOUNCE_RELEASE);
+            }
+        }
+    } else if (debounce_state && debounce_hold < debounce_long_ticks) {
+        if (++debounce_hold == debounce_long_ticks && EVENT_WANTED(EVENT_SOURCE_BUTTON)) {
+            EVENT_POST(EVENT_SOURCE_BUTTON, debounce_state, DEBOUNCE_LONG_PRESS);
+        }
+    }
+}
+
+static void debounce_set_long_ticks(void)
+{
+    uint16_t ticks = (uint16_t)(((uint32_t)debounce_long_ms * debounce_rate_hz) / 1000UL);
+
+    if (debounce_long_ms && ticks == 0) {
+        ticks = 1;
+    }
+
+    CLEAR_BIT(IE, 7);  // EA = 0, read by the tick
+    debounce_long_ticks = ticks;
+    SET_BIT(IE, 7);
+}
+
+bool debounceBegin(uint8_t pins, uint16_t rate_hz)
+{
+    uint8_t pin;
+
+    debounceEnd();
+
+    pins &= 0x3F;  // P3_0 .. P5_5
+    for (pin = 0; pin < 6; pin++) {
+        if (pins & DEBOUNCE_PIN(pin)) {
+            pinMode(pin, INPUT_PULLUP);
+        }
+    }
+
+    // Start from "released, counters full"
+    CLEAR_BIT(IE, 7);
+    debounce_state = 0;
+    debounce_ct0 = 0xFF;
+    debounce_ct1 = 0xFF;
+    debounce_hold = 0;
+    debounce_mask = pins;
+    SET_BIT(IE, 7);
+
+    if (rate_hz) {
+        debounce_rate_hz = rate_hz;
+    }
+    debounce_set_long_ticks();
+
+    if (!timerClaim(TIMER_SPARE, TIMER_OWNER_DEBOUNCE)) {
+        return false;
+    }
+    if (!timerStartPeriodic(TIMER_SPARE, debounce_rate_hz, debounceTick)) {
+        timerRelease(TIMER_SPARE, TIMER_OWNER_DEBOUNCE);
+        return false;
+    }
+    return true;
+}
+
+void debounceEnd(void)
+{
+    if (timerOwner(TIMER_SPARE) == TIMER_OWNER_DEBOUNCE) {
+        timerStop(TIMER_SPARE);
+        timerRelease(TIMER_SPARE, TIMER_OWNER_DEBOUNCE);
+    }
+    debounce_mask = 0;
+    debounce_state = 0;
+}
+
+void debounceLongPress(uint16_t ms)
+{
+    debounce_long_ms = ms;
+    debounce_set_long_ticks();
+}
+
+uint8_t debounceState(void)
+{
+    return debounce_state;
+}
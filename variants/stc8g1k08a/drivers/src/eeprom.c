@@ -0,0 +1,242 @@
+#include "Arduino.h"
+
+#if EEPROM_SECTORS < 2
+#error "EEPROM_SECTORS must be at least 2 for wear leveling"
+#endif
+
+// Each sector is a log of 4-byte records: [lo][hi][check][key].
+// Slot 0 holds the sector header [seq lo][seq hi][check][magic]; the
+// valid sector with the newest sequence number is the active one.
+// The key/magic byte is programmed last, so a record torn by a reset
+// fails its check and is skipped.
+#define EEPROM_RECORD_SIZE 4
+#define EEPROM_SLOTS (IAP_SECTOR_SIZE / EEPROM_RECORD_SIZE)
+#define EEPROM_MAGIC 0xE5
+#define EEPROM_CHECK(lo, hi, key) ((uint8_t)((lo) ^ (hi) ^ (key) ^ 0x5A))
+
+#if EEPROM_KEYS > EEPROM_SLOTS - 1 || EEPROM_KEYS > 0xFE
+#error "EEPROM_KEYS does not fit in one sector"
+#endif
+
+#define EEPROM_SECTOR_ADDR(s) (EEPROM_BASE + (uint16_t)(s) * IAP_SECTOR_SIZE)
+
+// Write-back cache - moved to XRAM to save internal RAM
+static MEM_COLD uint16_t eeprom_cache[EEPROM_KEYS];  // Values seen by the sketch
+static MEM_COLD uint16_t eeprom_flash[EEPROM_KEYS];  // Values stored in flash
+static MEM_COLD uint8_t eeprom_sector = 0;           // Active sector
+static MEM_COLD uint16_t eeprom_seq = 0;             // Active sector sequence number
+static MEM_COLD uint8_t eeprom_free = EEPROM_SLOTS;  // Next free slot in the active sector
+static MEM_COLD bool eeprom_ready = false;
+
+// Program one record and verify it
+static bool eeprom_put_record(uint16_t addr, uint8_t key, uint16_t value) {
+    uint8_t lo = LOW_BYTE(value);
+    uint8_t hi = HIGH_BYTE(value);
+    uint8_t check = EEPROM_CHECK(lo, hi, key);
+
+    iapWriteByte(addr, lo);
+    iapWriteByte(addr + 1, hi);
+    iapWriteByte(addr + 2, check);
+    iapWriteByte(addr + 3, key);
+
+    return iapReadByte(addr) == lo && iapReadByte(addr + 1) == hi &&
+           iapReadByte(addr + 2) == check && iapReadByte(addr + 3) == key;
+}
+
+// Read one record; returns false for torn or corrupted records
+static bool eeprom_get_record(uint16_t addr, uint8_t *key, uint16_t *value) {
+    uint8_t lo = iapReadByte(addr);
+    uint8_t hi = iapReadByte(addr + 1);
+    uint8_t check = iapReadByte(addr + 2);
+
+    *key = iapReadByte(addr + 3);
+    *value = MAKE_WORD(hi, lo);
+    return check == EEPROM_CHECK(lo, hi, *key);
+}
+
+static bool eeprom_slot_empty(uint16_t addr) {
+    return (iapReadByte(addr) & iapReadByte(addr + 1) &
+            iapReadByte(addr + 2) & iapReadByte(addr + 3)) == 0xFF;
+}
+
+// Erase a sector and write the live values into it, header last.
+// Until the header lands the previous sector stays active.
+static bool eeprom_fill_sector(uint8_t sector, uint16_t seq) {
+    uint16_t base = EEPROM_SECTOR_ADDR(sector);
+    uint8_t slot = 1;
+    uint8_t key;
+
+    if (!iapEraseSector(base)) {
+        return false;
+    }
+
+    for (key = 0; key < EEPROM_KEYS; key++) {
+        if (eeprom_cache[key] == EEPROM_UNSET) {
+            continue;  // Unset keys need no record
+        }
+        if (!eeprom_put_record(base + slot * EEPROM_RECORD_SIZE, key, eeprom_cache[key])) {
+            return false;
+        }
+        slot++;
+    }
+
+    if (!eeprom_put_record(base, EEPROM_MAGIC, seq)) {
+        return false;
+    }
+
+    for (key = 0; key < EEPROM_KEYS; key++) {
+        eeprom_flash[key] = eeprom_cache[key];
+    }
+    eeprom_sector = sector;
+    eeprom_seq = seq;
+    eeprom_free = slot;
+    return true;
+}
+
+// Move to the next sector in the rotation
+static bool eeprom_rotate(void) {
+    uint8_t next = eeprom_sector + 1;
+
+    if (next >= EEPROM_SECTORS) {
+        next = 0;
+    }
+    return eeprom_fill_sector(next, eeprom_seq + 1);
+}
+
+bool eepromBegin(void) {
+    uint8_t sector;
+    uint8_t slot;
+    uint8_t key;
+    uint16_t value;
+    uint16_t base;
+    bool found = false;
+
+    for (key = 0; key < EEPROM_KEYS; key++) {
+        eeprom_cache[key] = EEPROM_UNSET;
+        eeprom_flash[key] = EEPROM_UNSET;
+    }
+
+    // Newest valid header wins; sequence numbers compare modulo 2^16
+    for (sector = 0; sector < EEPROM_SECTORS; sector++) {
+        if (eeprom_get_record(EEPROM_SECTOR_ADDR(sector), &key, &value) &&
+            key == EEPROM_MAGIC &&
+            (!found || (int16_t)(value - eeprom_seq) > 0)) {
+            eeprom_sector = sector;
+            eeprom_seq = value;
+            found = true;
+        }
+    }
+
+    if (!found) {
+        eeprom_ready = eeprom_fill_sector(0, 0);
+        return eeprom_ready;
+    }
+
+    // Replay the log, later records override earlier ones
+    base = EEPROM_SECTOR_ADDR(eeprom_sector);
+    for (slot = 1; slot < EEPROM_SLOTS; slot++) {
+        uint16_t addr = base + slot * EEPROM_RECORD_SIZE;
+
+        if (eeprom_slot_empty(addr)) {
+            break;
+        }
+        if (eeprom_get_record(addr, &key, &value) && key < EEPROM_KEYS) {
+            eeprom_flash[key] = value;
+        }
+    }
+    eeprom_free = slot;
+
+    for (key = 0; key < EEPROM_KEYS; key++) {
+        eeprom_cache[key] = eeprom_flash[key];
+    }
+
+    eeprom_ready = true;
+    return true;
+}
+
+uint16_t eepromRead(uint8_t key) {
+    if (!eeprom_ready) eepromBegin();
+
+    if (key >= EEPROM_KEYS) {
+        return EEPROM_UNSET;
+    }
+    return eeprom_cache[key];
+}
+
+bool eepromWrite(uint8_t key, uint16_t value) {
+    if (!eeprom_ready) eepromBegin();
+
+    if (key >= EEPROM_KEYS) {
+        return false;
+    }
+    eeprom_cache[key] = value;
+    return true;
+}
+
+uint8_t eepromPending(void) {
+    uint8_t count = 0;
+    uint8_t key;
+
+    for (key = 0; key < EEPROM_KEYS; key++) {
+        if (eeprom_cache[key] != eeprom_flash[key]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool eepromCommit(void) {
+    uint16_t base;
+    uint8_t pending;
+    uint8_t key;
+
+    if (!eeprom_ready && !eepromBegin()) {
+        return false;
+    }
+
+    pending = eepromPending();
+    if (pending == 0) {
+        return true;  // Nothing changed, flash untouched
+    }
+
+    // Not enough room: the rotation writes every live value anyway
+    if (pending > EEPROM_SLOTS - eeprom_free) {
+        return eeprom_rotate();
+    }
+
+    base = EEPROM_SECTOR_ADDR(eeprom_sector);
+    for (key = 0; key < EEPROM_KEYS; key++) {
+        if (eeprom_cache[key] == eeprom_flash[key]) {
+            continue;
+        }
+        if (!eeprom_put_record(base + eeprom_free * EEPROM_RECORD_SIZE, key, eeprom_cache[key])) {
+            // Skip the bad slot; the next commit retries this key
+            eeprom_free++;
+            return false;
+        }
+        eeprom_flash[key] = eeprom_cache[key];
+        eeprom_free++;
+    }
+    return true;
+}
+
+bool eepromClear(void) {
+    uint8_t sector;
+    uint8_t key;
+
+    for (sector = 1; sector < EEPROM_SECTORS; sector++) {
+        if (!iapEraseSector(EEPROM_SECTOR_ADDR(sector))) {
+            return false;
+        }
+    }
+
+    for (key = 0; key < EEPROM_KEYS; key++) {
+        eeprom_cache[key] = EEPROM_UNSET;
+    }
+    eeprom_ready = eeprom_fill_sector(0, 0);
+    return eeprom_ready;
+}
+
+uint16_t eepromGeneration(void) {
+    return eeprom_seq;
+}
@@ -0,0 +1,151 @@
+#include "i2c_private.h"
+
+// ---------------------------------------------------------------------
+// Non-blocking transfers: each wirePoll() call issues at most one bus
+// command, so the caller never waits for the hardware.
+// ---------------------------------------------------------------------
+
+// Steps of an async transfer (last command issued)
+#define ASYNC_IDLE     0
+#define ASYNC_START    1
+#define ASYNC_ADDR     2
+#define ASYNC_ADDR_ACK 3
+#define ASYNC_TX_DATA  4
+#define ASYNC_TX_ACK   5
+#define ASYNC_RX_DATA  6
+#define ASYNC_RX_ACK   7
+#define ASYNC_STOP     8
+
+// Async transfer state - moved to XRAM to save internal RAM
+static MEM_COLD uint8_t async_step = ASYNC_IDLE;
+static MEM_COLD uint8_t async_result = WIRE_ASYNC_DONE;
+static MEM_COLD uint8_t async_addr = 0;       // 8-bit address incl. R/W bit
+static MEM_COLD const uint8_t *async_data;    // Bytes to send
+static MEM_COLD uint8_t async_len = 0;
+static MEM_COLD uint8_t async_pos = 0;
+static MEM_COLD bool async_stop = true;
+
+static bool i2c_async_start(uint8_t addr, uint8_t len, bool sendStop) {
+    if (async_step != ASYNC_IDLE) {
+        return false;
+    }
+
+    async_addr = addr;
+    async_len = len;
+    async_pos = 0;
+    async_stop = sendStop;
+    async_result = WIRE_ASYNC_BUSY;
+
+    ENABLE_XFR();
+    I2CMSST = 0x00;
+    I2CMSCR = I2C_CMD_START;
+    async_step = ASYNC_START;
+    return true;
+}
+
+bool wireWriteAsync(uint8_t address, const uint8_t *data, uint8_t len, bool sendStop) {
+    async_data = data;
+    return i2c_async_start(address << 1, len, sendStop);
+}
+
+bool wireRequestAsync(uint8_t address, uint8_t quantity, bool sendStop) {
+    if (quantity > I2C_BUFFER_SIZE - 1) {
+        quantity = I2C_BUFFER_SIZE - 1;
+    }
+    return i2c_async_start((address << 1) | 0x01, quantity, sendStop);
+}
+
+// Send the next byte of a write or finish it
+static void i2c_async_next_tx(void) {
+    if (async_pos < async_len) {
+        I2CTXD = async_data[async_pos++];
+        I2CMSCR = I2C_CMD_SENDDATA;
+        async_step = ASYNC_TX_DATA;
+    } else {
+        async_step = ASYNC_IDLE;  // Finished, see below
+    }
+}
+
+uint8_t wirePoll(void) {
+    if (async_step == ASYNC_IDLE) {
+        return async_result;
+    }
+
+    ENABLE_XFR();
+    if (!(I2CMSST & I2C_MSIF)) {
+        return WIRE_ASYNC_BUSY;  // Last command still running
+    }
+    I2CMSST &= ~I2C_MSIF;
+
+    switch (async_step) {
+        case ASYNC_START:
+            I2CTXD = async_addr;
+            I2CMSCR = I2C_CMD_SENDDATA;
+            async_step = ASYNC_ADDR;
+            return WIRE_ASYNC_BUSY;
+
+        case ASYNC_ADDR:
+        case ASYNC_TX_DATA:
+            I2CMSCR = I2C_CMD_RECVACK;
+            async_step++;  // ASYNC_ADDR_ACK or ASYNC_TX_ACK
+            return WIRE_ASYNC_BUSY;
+
+        case ASYNC_ADDR_ACK:
+        case ASYNC_TX_ACK:
+            if (I2CMSST & I2C_MSACKI) {
+                async_result = WIRE_ASYNC_NACK;
+                async_step = ASYNC_IDLE;
+            } else if (async_addr & 0x01) {
+                if (async_len) {
+                    I2CMSCR = I2C_CMD_RECVDATA;
+                    async_step = ASYNC_RX_DATA;
+                } else {
+                    async_step = ASYNC_IDLE;
+                }
+            } else {
+                i2c_async_next_tx();
+            }
+            break;
+
+        case ASYNC_RX_DATA:
+            {
+                uint8_t next_head = (i2c_rx_head + 1) % I2C_BUFFER_SIZE;
+                if (next_head != i2c_rx_tail) {
+                    i2c_rx_buffer[i2c_rx_head] = I2CRXD;
+                    i2c_rx_head = next_head;
+                }
+            }
+            async_pos++;
+            I2CMSST = (async_pos < async_len) ? 0x00 : I2C_MSACKO;  // NAK the last byte
+            I2CMSCR = I2C_CMD_SENDACK;
+            async_step = ASYNC_RX_ACK;
+            return WIRE_ASYNC_BUSY;
+
+        case ASYNC_RX_ACK:
+            if (async_pos < async_len) {
+                I2CMSCR = I2C_CMD_RECVDATA;
+                async_step = ASYNC_RX_DATA;
+            } else {
+                async_step = ASYNC_IDLE;
+            }
+            break;
+
+        case ASYNC_STOP:
+            async_step = ASYNC_IDLE;
+            return async_result;
+    }
+
+    // Transfer over (or NACKed): release the bus unless a repeated
+    // START was requested
+    if (async_step == ASYNC_IDLE) {
+        if (async_result == WIRE_ASYNC_BUSY) {
+            async_result = WIRE_ASYNC_DONE;
+        }
+        if (async_stop || async_result == WIRE_ASYNC_NACK) {
+            I2CMSCR = I2C_CMD_STOP;
+            async_step = ASYNC_STOP;
+            return WIRE_ASYNC_BUSY;
+        }
+    }
+    return async_step == ASYNC_IDLE ? async_result : WIRE_ASYNC_BUSY;
+}
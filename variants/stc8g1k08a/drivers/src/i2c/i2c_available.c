@@ -0,0 +1,6 @@
+#include "i2c_private.h"
+
+// Get number of bytes available in receive buffer
+uint8_t wireAvailable(void) {
+    return (I2C_BUFFER_SIZE + i2c_rx_head - i2c_rx_tail) % I2C_BUFFER_SIZE;
+}
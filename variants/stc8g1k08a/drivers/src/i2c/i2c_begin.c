@@ -0,0 +1,47 @@
+#include "i2c_private.h"
+
+static MEM_COLD I2cPinSelect_t current_pins = I2C_PINS_P32_P33;
+
+// Keep the bus speed after a system clock change
+static void i2c_clock_changed(void) {
+    ENABLE_XFR();
+    if (I2CCFG & I2C_ENI2C) {
+        I2CCFG = I2C_ENI2C | I2C_MASTER | i2c_calculate_speed(i2c_current_clock);
+    }
+}
+
+// Begin I2C with custom pins
+void wireBeginWithPins(I2cPinSelect_t pins) {
+    current_pins = pins;
+    
+    // Configure pins as open-drain with pull-up
+    if (pins == I2C_PINS_P54_P55) {
+        pinMode(P5_4, OUTPUT_OD_PU);  // SCL
+        pinMode(P5_5, OUTPUT_OD_PU);  // SDA
+        I2C_SWITCH_PINS(I2C_S_P54_P55);
+    } else {
+        pinMode(P3_2, OUTPUT_OD_PU);  // SCL
+        pinMode(P3_3, OUTPUT_OD_PU);  // SDA
+        I2C_SWITCH_PINS(I2C_S_P32_P33);
+    }
+    
+    // Enable XFR for I2C register access
+    ENABLE_XFR();
+    
+    // Configure I2C with default 100kHz
+    uint8_t speed = i2c_calculate_speed(i2c_current_clock);
+    I2CCFG = I2C_ENI2C | I2C_MASTER | speed;
+    I2CMSST = 0x00;
+    
+    // Reset buffers
+    i2c_rx_head = 0;
+    i2c_rx_tail = 0;
+    i2c_transmission_begun = false;
+
+    clockAddListener(i2c_clock_changed);
+}
+
+// Begin I2C with default settings (P3.2/P3.3, 100kHz)
+void wireBegin(void) {
+    wireBeginWithPins(I2C_PINS_P32_P33);
+}
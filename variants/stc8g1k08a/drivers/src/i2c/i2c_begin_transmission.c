@@ -0,0 +1,13 @@
+#include "i2c_private.h"
+
+static MEM_COLD uint8_t tx_address = 0;
+
+// Begin transmission to slave device
+void wireBeginTransmission(uint8_t address) {
+    tx_address = address << 1;  // Convert 7-bit to 8-bit write address
+    i2c_transmission_begun = true;
+    
+    i2c_send_start();
+    i2c_send_byte(tx_address);
+    i2c_recv_ack();
+}
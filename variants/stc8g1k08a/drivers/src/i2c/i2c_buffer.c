@@ -0,0 +1,6 @@
+#include "i2c_private.h"
+
+// Buffer for received data
+volatile MEM_RING uint8_t i2c_rx_buffer[I2C_BUFFER_SIZE];
+volatile MEM_HOT uint8_t i2c_rx_head = 0;
+volatile MEM_HOT uint8_t i2c_rx_tail = 0;
@@ -0,0 +1,66 @@
+#include "i2c_private.h"
+
+// Bus settings shared by begin, setClock and the transfer functions
+MEM_COLD uint32_t i2c_current_clock = I2C_CLOCK_100KHZ;
+MEM_COLD bool i2c_transmission_begun = false;
+
+// Helper functions
+void i2c_wait(void) {
+    uint16_t timeout = 5000;
+    TRACE_RECORD(TRACE_ID_I2C);
+    while (!(I2CMSST & I2C_MSIF) && timeout--) {
+        HW_WAIT(I2CMSST);
+    }
+    I2CMSST &= ~I2C_MSIF;  // Clear interrupt flag
+    TRACE_RECORD(TRACE_END(TRACE_ID_I2C));
+}
+
+void i2c_send_start(void) {
+    I2CMSCR = I2C_CMD_START;
+    i2c_wait();
+}
+
+void i2c_send_stop(void) {
+    I2CMSCR = I2C_CMD_STOP;
+    i2c_wait();
+}
+
+void i2c_send_byte(uint8_t data) {
+    I2CTXD = data;
+    I2CMSCR = I2C_CMD_SENDDATA;
+    i2c_wait();
+}
+
+uint8_t i2c_recv_byte(void) {
+    I2CMSCR = I2C_CMD_RECVDATA;
+    i2c_wait();
+    return I2CRXD;
+}
+
+void i2c_recv_ack(void) {
+    I2CMSCR = I2C_CMD_RECVACK;
+    i2c_wait();
+}
+
+void i2c_send_ack(void) {
+    I2CMSST = 0x00;  // ACK
+    I2CMSCR = I2C_CMD_SENDACK;
+    i2c_wait();
+}
+
+void i2c_send_nak(void) {
+    I2CMSST = 0x01;  // NAK
+    I2CMSCR = I2C_CMD_SENDACK;
+    i2c_wait();
+}
+
+// Calculate I2C speed setting
+uint8_t i2c_calculate_speed(uint32_t frequency) {
+    // Formula: I2C_speed = SYSclk / 2 / (MSSPEED * 2 + 4)
+    // Solve for MSSPEED: MSSPEED = (SYSclk / frequency / 2 - 4) / 2
+    uint32_t half_cycles = getSystemClock() / frequency / 2;
+    if (half_cycles <= 4) return 0;  // Clock too slow, run as fast as possible
+    half_cycles = (half_cycles - 4) / 2;
+    if (half_cycles > 63) half_cycles = 63;  // Max value is 6 bits
+    return (uint8_t)half_cycles;
+}
@@ -0,0 +1,7 @@
+#include "i2c_private.h"
+
+// End I2C communication
+void wireEnd(void) {
+    ENABLE_XFR();
+    I2CCFG = 0x00;  // Disable I2C
+}
@@ -0,0 +1,17 @@
+#include "i2c_private.h"
+
+// End transmission
+// sendStop: true = send STOP condition, false = repeated START
+// Returns: 0 = success, 1 = data too long, 2 = NACK on address, 3 = NACK on data, 4 = other error
+uint8_t wireEndTransmission(bool sendStop) {
+    if (!i2c_transmission_begun) {
+        return 4;  // No transmission in progress
+    }
+    
+    if (sendStop) {
+        i2c_send_stop();
+    }
+    
+    i2c_transmission_begun = false;
+    return 0;  // Success
+}
@@ -0,0 +1,17 @@
+#include "i2c_private.h"
+
+// I2C object instance. The initializer references every method, so a
+// sketch using Wire links all of them; calling the wire*() functions
+// directly links only the ones used.
+I2C_t Wire = {
+    .begin = wireBegin,
+    .beginWithPins = wireBeginWithPins,
+    .end = wireEnd,
+    .setClock = wireSetClock,
+    .read = wireRead,
+    .write = wireWrite,
+    .beginTransmission = wireBeginTransmission,
+    .endTransmission = wireEndTransmission,
+    .requestFrom = wireRequestFrom,
+    .available = wireAvailable,
+};
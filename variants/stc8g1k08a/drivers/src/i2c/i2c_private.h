@@ -0,0 +1,31 @@
+#ifndef I2C_PRIVATE_H
+#define I2C_PRIVATE_H
+
+#include "Arduino.h"
+
+// Shared state and bus primitives of the I2C driver. Each public
+// function lives in its own file so the link wrapper only pulls in
+// what a sketch calls.
+
+#define I2C_BUFFER_SIZE 32
+
+// Receive buffer (i2c_buffer.c)
+extern volatile MEM_RING uint8_t i2c_rx_buffer[I2C_BUFFER_SIZE];
+extern volatile MEM_HOT uint8_t i2c_rx_head;
+extern volatile MEM_HOT uint8_t i2c_rx_tail;
+
+// Bus settings and blocking bus commands (i2c_bus.c)
+extern MEM_COLD uint32_t i2c_current_clock;
+extern MEM_COLD bool i2c_transmission_begun;
+
+void i2c_wait(void);
+void i2c_send_start(void);
+void i2c_send_stop(void);
+void i2c_send_byte(uint8_t data);
+uint8_t i2c_recv_byte(void);
+void i2c_recv_ack(void);
+void i2c_send_ack(void);
+void i2c_send_nak(void);
+uint8_t i2c_calculate_speed(uint32_t frequency);
+
+#endif // I2C_PRIVATE_H
@@ -0,0 +1,12 @@
+#include "i2c_private.h"
+
+// Read one byte from buffer
+uint8_t wireRead(void) {
+    if (i2c_rx_head == i2c_rx_tail) {
+        return 0;  // No data available
+    }
+    
+    uint8_t data = i2c_rx_buffer[i2c_rx_tail];
+    i2c_rx_tail = (i2c_rx_tail + 1) % I2C_BUFFER_SIZE;
+    return data;
+}
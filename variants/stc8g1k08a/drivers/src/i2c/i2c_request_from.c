@@ -0,0 +1,41 @@
+#include "i2c_private.h"
+
+// Request bytes from slave device
+// Returns: number of bytes read
+uint8_t wireRequestFrom(uint8_t address, uint8_t quantity, bool sendStop) __reentrant {
+    if (quantity > I2C_BUFFER_SIZE) {
+        quantity = I2C_BUFFER_SIZE;
+    }
+    
+    // Send START + read address
+    i2c_send_start();
+    i2c_send_byte((address << 1) | 0x01);  // Read address
+    i2c_recv_ack();
+    
+    // Read bytes
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < quantity; i++) {
+        uint8_t data = i2c_recv_byte();
+        
+        // Store in buffer
+        uint8_t next_head = (i2c_rx_head + 1) % I2C_BUFFER_SIZE;
+        if (next_head != i2c_rx_tail) {
+            i2c_rx_buffer[i2c_rx_head] = data;
+            i2c_rx_head = next_head;
+            count++;
+        }
+        
+        // Send ACK for all except last byte
+        if (i < quantity - 1) {
+            i2c_send_ack();
+        } else {
+            i2c_send_nak();
+        }
+    }
+    
+    if (sendStop) {
+        i2c_send_stop();
+    }
+    
+    return count;
+}
@@ -0,0 +1,10 @@
+#include "i2c_private.h"
+
+// Set I2C clock frequency
+void wireSetClock(uint32_t frequency) __reentrant {
+    i2c_current_clock = frequency;
+    
+    ENABLE_XFR();
+    uint8_t speed = i2c_calculate_speed(frequency);
+    I2CCFG = I2C_ENI2C | I2C_MASTER | speed;
+}
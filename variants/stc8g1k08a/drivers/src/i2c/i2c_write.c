@@ -0,0 +1,11 @@
+#include "i2c_private.h"
+
+// Write one byte (queued until endTransmission)
+void wireWrite(uint8_t data) {
+    if (!i2c_transmission_begun) {
+        return;  // Must call beginTransmission first
+    }
+    
+    i2c_send_byte(data);
+    i2c_recv_ack();
+}
@@ -0,0 +1,45 @@
+#include "Arduino.h"
+
+// Run one IAP command; the CPU stalls until it completes
+static bool iap_command(uint8_t cmd, uint16_t addr) {
+    uint8_t ea_backup = IE & 0x80;
+    bool ok;
+
+    IAP_CONTR = IAP_IAPEN;
+    IAP_TPS = (uint8_t)((getSystemClock() + 999999UL) / 1000000UL);  // Wait time in MHz
+    IAP_CMD = cmd;
+    IAP_ADDRL = LOW_BYTE(addr);
+    IAP_ADDRH = HIGH_BYTE(addr);
+
+    CLEAR_BIT(IE, 7);  // EA = 0, the trigger keys must be back-to-back
+    IAP_TRIG = IAP_TRIG_KEY1;
+    IAP_TRIG = IAP_TRIG_KEY2;
+    if (ea_backup) SET_BIT(IE, 7);
+
+    ok = !(IAP_CONTR & IAP_CMD_FAIL);
+
+    // Disable IAP and park the address outside the EEPROM area
+    IAP_CONTR = 0x00;
+    IAP_CMD = IAP_CMD_IDLE;
+    IAP_TRIG = 0x00;
+    IAP_ADDRH = 0x80;
+    IAP_ADDRL = 0x00;
+
+    return ok;
+}
+
+uint8_t iapReadByte(uint16_t addr) {
+    if (!iap_command(IAP_CMD_READ, addr)) {
+        return 0xFF;
+    }
+    return IAP_DATA;
+}
+
+bool iapWriteByte(uint16_t addr, uint8_t data) {
+    IAP_DATA = data;
+    return iap_command(IAP_CMD_WRITE, addr);
+}
+
+bool iapEraseSector(uint16_t addr) {
+    return iap_command(IAP_CMD_ERASE, addr);
+}
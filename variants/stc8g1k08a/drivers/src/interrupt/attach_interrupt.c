@@ -0,0 +1,121 @@
+#include "interrupt_private.h"
+
+// Configure the trigger mode and enable an external interrupt
+static void interrupt_enable(uint8_t interrupt, uint8_t mode)
+{
+    switch (interrupt)
+    {
+        case INT0_INTERRUPT: // P3.2
+            // Configure trigger mode
+            // IT0 = 0: triggered by both rising and falling edges (CHANGE mode)
+            // IT0 = 1: triggered only by falling edge (FALLING mode)
+            if (mode == CHANGE || mode == RISING) {
+                CLEAR_BIT(TCON, 0); // IT0 = 0 (both edges)
+            } else { // FALLING or LOW
+                SET_BIT(TCON, 0);   // IT0 = 1 (falling edge only)
+            }
+            
+            // Clear flag and enable interrupt
+            CLEAR_BIT(TCON, 1);     // Clear IE0
+            SET_BIT(IE, 0);         // EX0 = 1 (enable INT0)
+            SET_BIT(IE, 7);         // EA = 1 (global enable)
+            break;
+            
+        case INT1_INTERRUPT: // P3.3
+            // Configure trigger mode
+            // IT1 = 0: triggered by both rising and falling edges (CHANGE mode)
+            // IT1 = 1: triggered only by falling edge (FALLING mode)
+            if (mode == CHANGE || mode == RISING) {
+                CLEAR_BIT(TCON, 2); // IT1 = 0 (both edges)
+            } else { // FALLING or LOW
+                SET_BIT(TCON, 2);   // IT1 = 1 (falling edge only)
+            }
+            
+            // Clear flag and enable interrupt
+            CLEAR_BIT(TCON, 3);     // Clear IE1
+            SET_BIT(IE, 2);         // EX1 = 1 (enable INT1)
+            SET_BIT(IE, 7);         // EA = 1 (global enable)
+            break;
+            
+        case INT2_INTERRUPT: // P5.4
+            // INT2 only supports edge-triggered (falling edge by default)
+            AUXINTIF &= ~AUXINTIF_INT2IF;  // Clear INT2IF
+            SET_BIT(INTCLKO, 4);    // EX2 = 1 (enable INT2)
+            SET_BIT(IE, 7);         // EA = 1 (global enable)
+            break;
+            
+        case INT3_INTERRUPT: // P5.5
+            // INT3 only supports edge-triggered (falling edge by default)
+            AUXINTIF &= ~AUXINTIF_INT3IF;  // Clear INT3IF
+            SET_BIT(INTCLKO, 5);    // EX3 = 1 (enable INT3)
+            SET_BIT(IE, 7);         // EA = 1 (global enable)
+            break;
+            
+        case INT4_INTERRUPT: // P3.0
+            // INT4 only supports edge-triggered (falling edge by default)
+            AUXINTIF &= ~AUXINTIF_INT4IF;  // Clear INT4IF
+            SET_BIT(INTCLKO, 6);    // EX4 = 1 (enable INT4)
+            SET_BIT(IE, 7);         // EA = 1 (global enable)
+            break;
+    }
+}
+
+void attachInterrupt(uint8_t interrupt, voidFuncPtr userFunc, uint8_t mode)
+{
+    if (!userFunc) return;
+    
+    switch (interrupt)
+    {
+        case INT0_INTERRUPT: int0_user_handler = userFunc; break;
+        case INT1_INTERRUPT: int1_user_handler = userFunc; break;
+        case INT2_INTERRUPT: int2_user_handler = userFunc; break;
+        case INT3_INTERRUPT: int3_user_handler = userFunc; break;
+        case INT4_INTERRUPT: int4_user_handler = userFunc; break;
+        default: return;
+    }
+    interrupt_enable(interrupt, mode);
+}
+
+void attachInterruptEvent(uint8_t interrupt, EventHandler_t handler, uint8_t mode)
+{
+    if (!handler || interrupt > INT4_INTERRUPT) return;
+
+    // The ISR only queues the edge; handler runs from dispatchEvents()
+    onEvent(EVENT_SOURCE_INT0 + interrupt, handler);
+    interrupt_enable(interrupt, mode);
+}
+
+void detachInterrupt(uint8_t interrupt)
+{
+    if (interrupt <= INT4_INTERRUPT) {
+        onEvent(EVENT_SOURCE_INT0 + interrupt, 0);
+    }
+
+    switch (interrupt)
+    {
+        case INT0_INTERRUPT:
+            CLEAR_BIT(IE, 0);       // EX0 = 0 (disable INT0)
+            int0_user_handler = 0;
+            break;
+            
+        case INT1_INTERRUPT:
+            CLEAR_BIT(IE, 2);       // EX1 = 0 (disable INT1)
+            int1_user_handler = 0;
+            break;
+            
+        case INT2_INTERRUPT:
+            CLEAR_BIT(INTCLKO, 4);  // EX2 = 0 (disable INT2)
+            int2_user_handler = 0;
+            break;
+            
+        case INT3_INTERRUPT:
+            CLEAR_BIT(INTCLKO, 5);  // EX3 = 0 (disable INT3)
+            int3_user_handler = 0;
+            break;
+            
+        case INT4_INTERRUPT:
+            CLEAR_BIT(INTCLKO, 6);  // EX4 = 0 (disable INT4)
+            int4_user_handler = 0;
+            break;
+    }
+}
@@ -0,0 +1,17 @@
+#include "interrupt_private.h"
+
+MEM_HOT voidFuncPtr int0_user_handler = 0;
+
+void INT0_ISR(void) __interrupt(INT0_ISR_VECTOR)
+{
+    TRACE_RECORD(TRACE_ID_INT0);
+    if (int0_user_handler) {
+        int0_user_handler();
+    }
+    if (EVENT_WANTED(EVENT_SOURCE_INT0)) {
+        EVENT_POST(EVENT_SOURCE_INT0, IS_BIT_SET(P3, 2), 0);
+    }
+    CLEAR_BIT(TCON, 1); // Clear IE0 flag
+    wakeup_irq = 1;
+    TRACE_RECORD(TRACE_END(TRACE_ID_INT0));
+}
@@ -0,0 +1,17 @@
+#include "interrupt_private.h"
+
+MEM_HOT voidFuncPtr int1_user_handler = 0;
+
+void INT1_ISR(void) __interrupt(INT1_ISR_VECTOR)
+{
+    TRACE_RECORD(TRACE_ID_INT1);
+    if (int1_user_handler) {
+        int1_user_handler();
+    }
+    if (EVENT_WANTED(EVENT_SOURCE_INT1)) {
+        EVENT_POST(EVENT_SOURCE_INT1, IS_BIT_SET(P3, 3), 0);
+    }
+    CLEAR_BIT(TCON, 3); // Clear IE1 flag
+    wakeup_irq = 1;
+    TRACE_RECORD(TRACE_END(TRACE_ID_INT1));
+}
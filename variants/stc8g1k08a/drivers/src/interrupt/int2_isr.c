@@ -0,0 +1,17 @@
+#include "interrupt_private.h"
+
+MEM_HOT voidFuncPtr int2_user_handler = 0;
+
+void INT2_ISR(void) __interrupt(INT2_ISR_VECTOR)
+{
+    TRACE_RECORD(TRACE_ID_INT2);
+    if (int2_user_handler) {
+        int2_user_handler();
+    }
+    if (EVENT_WANTED(EVENT_SOURCE_INT2)) {
+        EVENT_POST(EVENT_SOURCE_INT2, IS_BIT_SET(P5, 4), 0);
+    }
+    AUXINTIF &= ~AUXINTIF_INT2IF; // Clear INT2IF flag
+    wakeup_irq = 1;
+    TRACE_RECORD(TRACE_END(TRACE_ID_INT2));
+}
@@ -0,0 +1,17 @@
+#include "interrupt_private.h"
+
+MEM_HOT voidFuncPtr int3_user_handler = 0;
+
+void INT3_ISR(void) __interrupt(INT3_ISR_VECTOR)
+{
+    TRACE_RECORD(TRACE_ID_INT3);
+    if (int3_user_handler) {
+        int3_user_handler();
+    }
+    if (EVENT_WANTED(EVENT_SOURCE_INT3)) {
+        EVENT_POST(EVENT_SOURCE_INT3, IS_BIT_SET(P5, 5), 0);
+    }
+    AUXINTIF &= ~AUXINTIF_INT3IF; // Clear INT3IF flag
+    wakeup_irq = 1;
+    TRACE_RECORD(TRACE_END(TRACE_ID_INT3));
+}
@@ -0,0 +1,17 @@
+#include "interrupt_private.h"
+
+MEM_HOT voidFuncPtr int4_user_handler = 0;
+
+void INT4_ISR(void) __interrupt(INT4_ISR_VECTOR)
+{
+    TRACE_RECORD(TRACE_ID_INT4);
+    if (int4_user_handler) {
+        int4_user_handler();
+    }
+    if (EVENT_WANTED(EVENT_SOURCE_INT4)) {
+        EVENT_POST(EVENT_SOURCE_INT4, IS_BIT_SET(P3, 0), 0);
+    }
+    AUXINTIF &= ~AUXINTIF_INT4IF; // Clear INT4IF flag
+    wakeup_irq = 1;
+    TRACE_RECORD(TRACE_END(TRACE_ID_INT4));
+}
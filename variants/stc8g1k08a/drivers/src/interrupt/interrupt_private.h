@@ -0,0 +1,17 @@
+#ifndef INTERRUPT_PRIVATE_H
+#define INTERRUPT_PRIVATE_H
+
+#include "Arduino.h"
+
+// Each INTx ISR lives in its own file next to its handler pointer.
+// attach_interrupt.c references all five pointers, so the link wrapper
+// only pulls the real ISRs into sketches that attach an interrupt; the
+// rest get the empty placeholders from cores/stc8/isr.
+
+extern MEM_HOT voidFuncPtr int0_user_handler;  // int0_isr.c
+extern MEM_HOT voidFuncPtr int1_user_handler;  // int1_isr.c
+extern MEM_HOT voidFuncPtr int2_user_handler;  // int2_isr.c
+extern MEM_HOT voidFuncPtr int3_user_handler;  // int3_isr.c
+extern MEM_HOT voidFuncPtr int4_user_handler;  // int4_isr.c
+
+#endif // INTERRUPT_PRIVATE_H
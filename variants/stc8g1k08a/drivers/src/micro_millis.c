@@ -1,47 +1,113 @@
 #include "Arduino.h"
+#if TICK_TIMER == 2
+#include "clock_out/clock_out_private.h"  // Timed tone() ends in the tick
+#endif
 
-static volatile uint8_t timer_initialized = 0;
-static volatile __xdata uint32_t _millis = 0;
-static volatile __xdata uint32_t _micros_overflow = 0;
+// Tick timer registers, selected with TICK_TIMER (see timer.h)
+#if TICK_TIMER == 2
+#define TICK_TH T2H
+#define TICK_TL T2L
+#define TICK_RUN()  (AUXR |= AUXR_T2R)
+#define TICK_STOP() (AUXR &= ~AUXR_T2R)
+#else
+#define TICK_TH TH0
+#define TICK_TL TL0
+#define TICK_RUN()  (TCON |= (1 << 4))   // TR0 = 1
+#define TICK_STOP() (TCON &= ~(1 << 4))  // TR0 = 0
+#endif
+
+static volatile MEM_HOT uint8_t timer_initialized = 0;
+volatile MEM_WARM uint32_t _millis = 0;  // Also read directly by EVENT_POST()
+static volatile MEM_WARM uint32_t _micros_overflow = 0;
+static MEM_COLD uint16_t _credit_remainder_us = 0;  // Sub-ms part of credited time
 
 // Store timer configuration for micros calculation
-static uint16_t timer_reload_value = 0;
-static uint16_t cycles_per_ms = 0;
+static MEM_HOT uint16_t timer_reload_value = 0;
+static MEM_HOT uint16_t cycles_per_ms = 0;
+static MEM_HOT uint16_t cycles_per_us_q8 = 0;  // Cycles per us x 256, for delay_cycles_us()
+
+// Retime the 1 ms tick after a system clock change
+static void millis_clock_changed(void)
+{
+  uint8_t ea_backup = IE & 0x80;
+
+  IE &= ~(1 << 7);    // EA = 0 so micros() sees a consistent pair
+  cycles_per_ms = getSystemClock() / 1000UL;
+  cycles_per_us_q8 = (uint16_t)(((uint32_t)cycles_per_ms * 256UL + 999UL) / 1000UL);  // Rounded up
+  timer_reload_value = 65536UL - cycles_per_ms;
+
+  TICK_STOP();        // Writes now load the reload value
+  TICK_TH = (uint8_t)(timer_reload_value >> 8);
+  TICK_TL = (uint8_t)(timer_reload_value & 0xFF);
+  TICK_RUN();
+  if (ea_backup) IE |= (1 << 7);
+}
 
 static void timer_init(void)
 {
+  timerClaim(TICK_TIMER, TIMER_OWNER_TICK);
+
   // Stop timer first
-  TCON &= ~(1 << 4);  // TR0 = 0
+  TICK_STOP();
 
-  // Configure Timer0: Mode 0 (13-bit auto-reload)
+#if TICK_TIMER == 2
+  // Configure Timer2: always 16-bit auto-reload
+  AUXR &= ~AUXR_T2_CT; // Timer mode
+  AUXR |= AUXR_T2x12;  // 1T mode
+#else
+  // Configure Timer0: Mode 0 (16-bit auto-reload)
   TMOD &= 0xF0;       // Clear T0 mode bits (M1=0, M0=0 = Mode 0)
   TMOD &= ~(1 << 2);  // C/T = 0 (timer mode)
   TMOD &= ~(1 << 3);  // GATE = 0
 
   // Use 1T mode for precision
   AUXR |= (1 << 7);   // T0x12 = 1 (1T mode)
+#endif
 
-  // Calculate reload value for 1ms at F_CPU in 1T mode
+  // Calculate reload value for 1ms at the system clock in 1T mode
   // For 20MHz: 65536 - 20000 = 45536 = 0xB1E0
-  cycles_per_ms = F_CPU / 1000UL;
+  cycles_per_ms = getSystemClock() / 1000UL;
+  cycles_per_us_q8 = (uint16_t)(((uint32_t)cycles_per_ms * 256UL + 999UL) / 1000UL);  // Rounded up
   timer_reload_value = 65536UL - cycles_per_ms;
   
-  TH0 = (uint8_t)(timer_reload_value >> 8);
-  TL0 = (uint8_t)(timer_reload_value & 0xFF);
+  TICK_TH = (uint8_t)(timer_reload_value >> 8);
+  TICK_TL = (uint8_t)(timer_reload_value & 0xFF);
 
+#if TICK_TIMER == 2
+  // Clear overflow flag and enable Timer2 interrupt
+  AUXINTIF &= ~AUXINTIF_T2IF;
+  IE2 |= IE2_ET2;
+#else
   // Clear overflow flag
   TCON &= ~(1 << 5);  // TF0 = 0
 
   // Enable Timer0 interrupt
   IE |= (1 << 1);     // ET0 = 1
+#endif
 
   // Enable global interrupts
   IE |= (1 << 7);     // EA = 1
 
   // Start timer
-  TCON |= (1 << 4);   // TR0 = 1
+  TICK_RUN();
   
   timer_initialized = 1;
+  clockAddListener(millis_clock_changed);
+}
+
+// Read the running tick counter; re-read if the low byte wrapped
+// between the two reads
+uint16_t tick_read(void)
+{
+  uint8_t th = TICK_TH;
+  uint8_t tl = TICK_TL;
+
+  if (TICK_TH != th)
+  {
+    th = TICK_TH;
+    tl = TICK_TL;
+  }
+  return ((uint16_t)th << 8) | tl;
 }
 
 uint32_t millis(void)
@@ -66,7 +132,6 @@ uint32_t micros(void)
 {
   uint32_t m;
   uint16_t timer_count;
-  uint8_t tl, th;
   
   // Initialize on first call
   if (!timer_initialized)
@@ -78,9 +143,7 @@ uint32_t micros(void)
   IE &= ~(1 << 7);  // EA = 0
   
   // Read current timer value
-  tl = TL0;
-  th = TH0;
-  timer_count = ((uint16_t)th << 8) | tl;
+  timer_count = tick_read();
   
   // Get current millisecond count
   m = _millis;
@@ -98,7 +161,7 @@ uint32_t micros(void)
   }
   
   // Convert to microseconds
-  // elapsed_us = (elapsed_cycles * 1000000) / F_CPU
+  // elapsed_us = (elapsed_cycles * 1000000) / system clock
   // Simplified: elapsed_us = (elapsed_cycles * 1000) / cycles_per_ms
   uint32_t elapsed_us = ((uint32_t)elapsed_cycles * 1000UL) / cycles_per_ms;
   
@@ -106,10 +169,108 @@ uint32_t micros(void)
   return (m * 1000UL) + elapsed_us;
 }
 
-// Timer 0 Overflow Interrupt Service Routine
+// Busy-wait on the running tick counter, so delays no longer take a
+// timer away from millis(). The counter must be polled at least once
+// per tick period (1 ms).
+void delay_cycles(uint32_t cycles)
+{
+  uint16_t prev, now, elapsed;
+
+  if (!timer_initialized)
+  {
+    timer_init();
+  }
+
+  prev = tick_read();
+  while (cycles)
+  {
+    HW_WAIT(TICK_TL);
+    now = tick_read();
+    elapsed = now - prev;
+    if (now < prev)
+    {
+      elapsed -= timer_reload_value;  // Skip the values below the reload
+    }
+    prev = now;
+
+    if (elapsed >= cycles)
+    {
+      break;
+    }
+    cycles -= elapsed;
+  }
+}
+
+void delay_cycles_since(uint16_t start, uint16_t cycles)
+{
+  uint16_t now, elapsed;
+
+  do
+  {
+    HW_WAIT(TICK_TL);
+    now = tick_read();
+    elapsed = now - start;
+    if (now < start)
+    {
+      elapsed -= timer_reload_value;  // Skip the values below the reload
+    }
+  } while (elapsed < cycles);
+}
+
+// Add time that passed while the tick timer was stopped (e.g. in power-down).
+// Fractions of a millisecond are carried to the next call so repeated
+// short sleeps do not drift.
+void millis_credit_us(uint32_t us)
+{
+  uint32_t ms;
+
+  us += _credit_remainder_us;
+  ms = us / 1000UL;
+  _credit_remainder_us = (uint16_t)(us - ms * 1000UL);
+
+  IE &= ~(1 << 7);  // EA = 0
+  _millis += ms;
+  IE |= (1 << 7);   // EA = 1
+}
+
+// Tick Timer Overflow Interrupt Service Routine
+#if TICK_TIMER == 2
+void timer2_isr(void) __interrupt(12)
+#else
 void timer0_isr(void) __interrupt(1)
+#endif
 {
   _millis++;
-  // Mode 0 automatically reloads from hidden registers
-  // TF0 is automatically cleared when entering ISR
-}
\ No newline at end of file
+  TRACE_RECORD(TRACE_ID_TICK);  // After the increment so the stamp is current
+#if TICK_TIMER == 2
+  // End of a timed tone() (Timer0 is free for it only in this build)
+  if (clock_out_ms_left && --clock_out_ms_left == 0)
+  {
+    CLOCK_OUT_SILENCE();
+  }
+#endif
+  // Auto-reload from hidden registers
+  // TF0/T2IF is automatically cleared when entering ISR
+  TRACE_RECORD(TRACE_END(TRACE_ID_TICK));
+}
+
+void delay_cycles_us(uint32_t us)
+{
+  uint16_t per_us_q8;
+
+  if (!timer_initialized)
+  {
+    timer_init();
+  }
+  per_us_q8 = cycles_per_us_q8;
+
+  // Whole 65536 us blocks first, so the rest is a 16x16 multiply
+  while (us > 0xFFFFUL)
+  {
+    delay_cycles((uint32_t)per_us_q8 << 8);
+    us -= 0x10000UL;
+  }
+
+  // Rounded up: below 1 MHz a short non-zero delay still waits a cycle
+  delay_cycles(((uint32_t)(uint16_t)us * per_us_q8 + 255UL) >> 8);
+}
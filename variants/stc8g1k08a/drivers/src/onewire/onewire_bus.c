@@ -0,0 +1,130 @@
+#include "onewire_private.h"
+
+// Slot timing (Maxim AN126, standard speed), indices into onewire_us[]
+#define ONEWIRE_WRITE1_LOW  0  // 1..15 us
+#define ONEWIRE_SAMPLE      1  // Master samples before 15 us
+#define ONEWIRE_WRITE0_LOW  2
+#define ONEWIRE_SLOT        3  // Including recovery
+#define ONEWIRE_RESET_LOW   4
+#define ONEWIRE_PRESENCE    5
+#define ONEWIRE_RESET_HIGH  6
+#define ONEWIRE_TIMES       7
+
+static const __code uint16_t onewire_us[ONEWIRE_TIMES] = {
+    3, 11, 60, 70, 480, 70, 480
+};
+
+// Bus pin as a port mask; port 3 unless onewire_p5 is set
+static MEM_HOT uint8_t onewire_mask = 0;
+static MEM_HOT bool onewire_p5 = false;
+
+// The times above in tick clocks, rounded up and refreshed on reset so
+// a clock divider change is picked up. Converted ahead so no multiply
+// runs inside a slot. onewire_timed is false below 1 MHz, where the
+// slots cannot be timed.
+static MEM_COLD uint16_t onewire_clk[ONEWIRE_TIMES];
+static MEM_HOT bool onewire_timed = false;
+
+#define onewire_low() do { \
+    if (onewire_p5) P5 &= ~onewire_mask; else P3 &= ~onewire_mask; \
+} while(0)
+
+#define onewire_release() do { \
+    if (onewire_p5) P5 |= onewire_mask; else P3 |= onewire_mask; \
+} while(0)
+
+#define onewire_level() (((onewire_p5 ? P5 : P3) & onewire_mask) != 0)
+
+// Wait until one of the slot times has passed since start
+#define onewire_wait(start, time) delay_cycles_since(start, onewire_clk[time])
+
+static void onewire_timing(void)
+{
+    uint32_t clk = getSystemClock();
+    uint16_t per_us_q8 = (uint16_t)((clk / 1000UL * 256UL + 999UL) / 1000UL);
+    uint8_t i;
+
+    onewire_timed = (clk >= 1000000UL);
+    for (i = 0; i < ONEWIRE_TIMES; i++) {
+        onewire_clk[i] = (uint16_t)(((uint32_t)onewire_us[i] * per_us_q8 + 255UL) >> 8);
+    }
+}
+
+void oneWireBegin(uint8_t pin)
+{
+    onewire_mask = GET_MASK(pin);
+    onewire_p5 = (GET_PORT(pin) == PORT5);
+    onewire_release();
+    pinMode(pin, OUTPUT_OD_PU);
+
+    micros();  // Starts the tick timer if nothing has yet
+    onewire_timing();
+}
+
+bool oneWireReset(void)
+{
+    uint16_t start;
+    bool present;
+    uint8_t ea = IE & 0x80;
+
+    onewire_timing();
+    if (!onewire_timed) {
+        return false;  // Below 1 MHz the slots cannot be timed
+    }
+
+    // A longer low pulse is fine, so interrupts may run here
+    start = tick_read();
+    onewire_low();
+    onewire_wait(start, ONEWIRE_RESET_LOW);
+
+    CLEAR_BIT(IE, 7);
+    start = tick_read();
+    onewire_release();
+    onewire_wait(start, ONEWIRE_PRESENCE);
+    present = !onewire_level();
+    if (ea) SET_BIT(IE, 7);
+
+    onewire_wait(start, ONEWIRE_RESET_HIGH);
+    return present;
+}
+
+bool onewire_slot(bool bit)
+{
+    uint16_t start;
+    bool level;
+    uint8_t ea = IE & 0x80;
+
+    if (!onewire_timed) {
+        return true;  // Released bus, as with no device
+    }
+
+    // Interrupts off from the falling edge to the release of a 0 bit,
+    // so neither the low time nor the sample point can stretch
+    CLEAR_BIT(IE, 7);
+    start = tick_read();
+    onewire_low();
+    if (bit) {
+        onewire_wait(start, ONEWIRE_WRITE1_LOW);
+        onewire_release();
+        onewire_wait(start, ONEWIRE_SAMPLE);
+        level = onewire_level();
+    } else {
+        onewire_wait(start, ONEWIRE_WRITE0_LOW);
+        onewire_release();
+        level = false;
+    }
+    if (ea) SET_BIT(IE, 7);
+
+    onewire_wait(start, ONEWIRE_SLOT);
+    return level;
+}
+
+void oneWireWriteBit(bool bit)
+{
+    onewire_slot(bit);
+}
+
+bool oneWireReadBit(void)
+{
+    return onewire_slot(true);
+}
@@ -0,0 +1,25 @@
+#include "onewire_private.h"
+
+void oneWireWrite(uint8_t byte)
+{
+    uint8_t i;
+
+    for (i = 0; i < 8; i++) {
+        onewire_slot(byte & 1);
+        byte >>= 1;
+    }
+}
+
+uint8_t oneWireRead(void)
+{
+    uint8_t byte = 0;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++) {
+        byte >>= 1;
+        if (onewire_slot(true)) {
+            byte |= 0x80;
+        }
+    }
+    return byte;
+}
@@ -0,0 +1,16 @@
+#ifndef ONEWIRE_PRIVATE_H
+#define ONEWIRE_PRIVATE_H
+
+#include "Arduino.h"
+
+// The bus pin and slot timing live in onewire_bus.c; bytes, addressing
+// and the ROM search have their own files so the linker only pulls in
+// what a sketch calls.
+
+/**
+ * @brief One time slot: write bit, or write 1 and sample the answer
+ * @return Bus level at the sample point
+ */
+bool onewire_slot(bool bit);
+
+#endif // ONEWIRE_PRIVATE_H
@@ -0,0 +1,81 @@
+#include "onewire_private.h"
+
+// Search state between calls (Maxim AN187)
+static MEM_COLD uint8_t onewire_last_discrepancy = 0;
+static MEM_COLD bool onewire_last_device = false;
+static MEM_COLD uint8_t onewire_rom[ONEWIRE_ROM_SIZE];
+
+void oneWireResetSearch(void)
+{
+    uint8_t i;
+
+    onewire_last_discrepancy = 0;
+    onewire_last_device = false;
+    for (i = 0; i < ONEWIRE_ROM_SIZE; i++) {
+        onewire_rom[i] = 0;
+    }
+}
+
+// Each ROM bit is read twice (bit, complement) from all devices still
+// in the search, then the master writes the branch it follows. At a
+// 0/1 conflict it takes the path it did not take last time.
+bool oneWireSearch(uint8_t *rom)
+{
+    uint8_t bit_number;
+    uint8_t last_zero = 0;
+    uint8_t byte_index, mask;
+    bool bit, complement, direction;
+
+    if (onewire_last_device || !oneWireReset()) {
+        oneWireResetSearch();
+        return false;
+    }
+
+    oneWireWrite(ONEWIRE_SEARCH_ROM);
+    for (bit_number = 1; bit_number <= 64; bit_number++) {
+        byte_index = (bit_number - 1) >> 3;
+        mask = 1 << ((bit_number - 1) & 7);
+
+        bit = oneWireReadBit();
+        complement = oneWireReadBit();
+        if (bit && complement) {
+            oneWireResetSearch();  // No device answered
+            return false;
+        }
+
+        if (bit != complement) {
+            direction = bit;  // All remaining devices agree
+        } else {
+            if (bit_number < onewire_last_discrepancy) {
+                direction = (onewire_rom[byte_index] & mask) != 0;
+            } else {
+                direction = (bit_number == onewire_last_discrepancy);
+            }
+            if (!direction) {
+                last_zero = bit_number;
+            }
+        }
+
+        if (direction) {
+            onewire_rom[byte_index] |= mask;
+        } else {
+            onewire_rom[byte_index] &= ~mask;
+        }
+        oneWireWriteBit(direction);
+    }
+
+    onewire_last_discrepancy = last_zero;
+    onewire_last_device = (last_zero == 0);
+
+    // The last byte is the CRC8 of the first seven; over all eight it is
+    // 0. A bus held low reads as the all-zero ROM, which has no family.
+    if (crc8(CRC8_INIT, onewire_rom, ONEWIRE_ROM_SIZE) != 0 || !onewire_rom[0]) {
+        oneWireResetSearch();
+        return false;
+    }
+
+    for (byte_index = 0; byte_index < ONEWIRE_ROM_SIZE; byte_index++) {
+        rom[byte_index] = onewire_rom[byte_index];
+    }
+    return true;
+}
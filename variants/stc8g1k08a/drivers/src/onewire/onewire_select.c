@@ -0,0 +1,16 @@
+#include "onewire_private.h"
+
+void oneWireSelect(const uint8_t *rom)
+{
+    uint8_t i;
+
+    if (!rom) {
+        oneWireWrite(ONEWIRE_SKIP_ROM);
+        return;
+    }
+
+    oneWireWrite(ONEWIRE_MATCH_ROM);
+    for (i = 0; i < ONEWIRE_ROM_SIZE; i++) {
+        oneWireWrite(rom[i]);
+    }
+}
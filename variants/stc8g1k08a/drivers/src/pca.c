@@ -0,0 +1,96 @@
+#include "Arduino.h"
+
+// PCA counter clock - kept in XRAM to save internal RAM
+static MEM_COLD PcaClock_t pca_clock = PCA_CLOCK_SYSCLK_DIV12;
+
+// Driver that switched the clock away from the PWM setting, and the
+// setting to restore when it lets go
+static MEM_COLD uint8_t pca_owner = PCA_CLOCK_OWNER_FREE;
+static MEM_COLD PcaClock_t pca_saved_clock;
+
+// Start the PCA counter if it is not already running
+void pca_start(void) {
+    if (CCON & PCA_CR) {
+        return;
+    }
+
+    // Route CCP0/CCP1/CCP2 to P3.2/P3.3/P5.4
+    CCP_SWITCH_PINS(CCP_S_P32_P33_P54);
+
+    // Counter keeps running in idle mode (CIDL = 0)
+    CMOD = (CMOD & ~CMOD_CPS_MASK) | pca_clock;
+
+    CL = 0;
+    CH = 0;
+    CCON = PCA_CR;  // Start counter, clear all flags
+}
+
+// Change the counter clock; the counter restarts from zero
+void pca_set_clock(PcaClock_t clock) {
+    uint8_t running = CCON & PCA_CR;
+
+    pca_clock = clock;
+
+    CLEAR_BIT_MASK(CCON, PCA_CR);  // Stop counter while switching source
+    CMOD = (CMOD & ~CMOD_CPS_MASK) | clock;
+
+    if (running) {
+        CL = 0;
+        CH = 0;
+        SET_BIT_MASK(CCON, PCA_CR);
+    }
+}
+
+PcaClock_t pca_get_clock(void) {
+    return pca_clock;
+}
+
+bool pca_claim_clock(uint8_t owner, PcaClock_t clock) {
+    if (pca_owner != PCA_CLOCK_OWNER_FREE && pca_owner != owner) {
+        return false;
+    }
+    if (pca_owner == PCA_CLOCK_OWNER_FREE) {
+        pca_saved_clock = pca_clock;
+        pca_owner = owner;
+    }
+    if (clock != pca_clock) {
+        pca_set_clock(clock);
+    }
+    return true;
+}
+
+void pca_release_clock(uint8_t owner) {
+    if (pca_owner == owner && owner != PCA_CLOCK_OWNER_FREE) {
+        pca_owner = PCA_CLOCK_OWNER_FREE;
+        pca_set_clock(pca_saved_clock);
+    }
+}
+
+uint8_t pca_clock_owner(void) {
+    return pca_owner;
+}
+
+// Counter input frequency in Hz (0 if clocked externally)
+uint32_t pca_clock_hz(void) {
+    uint32_t clk = getSystemClock();
+
+    switch (pca_clock) {
+        case PCA_CLOCK_SYSCLK:       return clk;
+        case PCA_CLOCK_SYSCLK_DIV2:  return clk / 2;
+        case PCA_CLOCK_SYSCLK_DIV4:  return clk / 4;
+        case PCA_CLOCK_SYSCLK_DIV6:  return clk / 6;
+        case PCA_CLOCK_SYSCLK_DIV8:  return clk / 8;
+        case PCA_CLOCK_SYSCLK_DIV12: return clk / 12;
+        default:                     return 0;  // Timer0 or ECI
+    }
+}
+
+// Map an Arduino pin number to its PCA module
+uint8_t pca_pin_to_channel(uint8_t pin) {
+    switch (pin) {
+        case P3_2: return 0;  // CCP0
+        case P3_3: return 1;  // CCP1
+        case P5_4: return 2;  // CCP2
+        default:   return PCA_NO_CHANNEL;
+    }
+}
@@ -0,0 +1,177 @@
+#include "Arduino.h"
+
+// PWM resolution for the next analogWrite() - kept in XRAM to save internal RAM
+static MEM_COLD uint8_t pwm_bits = PWM_RESOLUTION_8BIT;
+
+// PCA_PWMn EBS field for the current resolution
+static uint8_t pwm_ebs(void) {
+    switch (pwm_bits) {
+        case PWM_RESOLUTION_6BIT:  return PCA_EBS_6BIT;
+        case PWM_RESOLUTION_7BIT:  return PCA_EBS_7BIT;
+        case PWM_RESOLUTION_10BIT: return PCA_EBS_10BIT;
+        default:                   return PCA_EBS_8BIT;
+    }
+}
+
+static uint8_t pwm_get_mode(uint8_t channel) {
+    switch (channel) {
+        case 0:  return CCAPM0;
+        case 1:  return CCAPM1;
+        default: return CCAPM2;
+    }
+}
+
+static uint8_t pwm_get_ctrl(uint8_t channel) {
+    switch (channel) {
+        case 0:  return PCA_PWM0;
+        case 1:  return PCA_PWM1;
+        default: return PCA_PWM2;
+    }
+}
+
+// Write the PWM control and compare registers of a module.
+// On start the active compare value (CCAPnL) is loaded as well and the
+// module is switched to PWM mode; otherwise only the reload value
+// (CCAPnH) is written and the PCA copies it at the next period boundary.
+static void pwm_write(uint8_t channel, uint8_t ctrl, uint8_t value, bool start) {
+    switch (channel) {
+        case 0:
+            PCA_PWM0 = ctrl;
+            CCAP0H = value;
+            if (start) {
+                CCAP0L = value;
+                CCAPM0 = PCA_ECOM | PCA_PWM;
+            }
+            break;
+
+        case 1:
+            PCA_PWM1 = ctrl;
+            CCAP1H = value;
+            if (start) {
+                CCAP1L = value;
+                CCAPM1 = PCA_ECOM | PCA_PWM;
+            }
+            break;
+
+        default:
+            PCA_PWM2 = ctrl;
+            CCAP2H = value;
+            if (start) {
+                CCAP2L = value;
+                CCAPM2 = PCA_ECOM | PCA_PWM;
+            }
+            break;
+    }
+}
+
+// Wait until the counter is in the first half of a PWM period, so two
+// register writes cannot straddle the reload at the period boundary
+static void pwm_wait_first_half(void) {
+    uint16_t timeout = 5000;  // Guard against a stopped ECI/Timer0 clock
+
+    if (pwm_bits == PWM_RESOLUTION_10BIT) {
+        while ((CH & 0x02) && timeout--);  // Counter bit 9
+    } else {
+        uint8_t half = (uint8_t)(1 << (pwm_bits - 1));
+        while ((CL & half) && timeout--);
+    }
+}
+
+void analogWrite(uint8_t pin, uint16_t duty) {
+    uint8_t channel = pca_pin_to_channel(pin);
+    uint16_t period = (uint16_t)1 << pwm_bits;
+    uint16_t compare;
+    uint8_t ctrl;
+    uint8_t old_ctrl;
+    uint8_t ea_backup;
+
+    // No CCP output on this pin: behave like a digital pin
+    if (channel == PCA_NO_CHANNEL) {
+        pinMode(pin, OUTPUT);
+        digitalWrite(pin, duty >= (period >> 1));
+        return;
+    }
+
+    // The output is LOW while the counter is below the compare value and
+    // HIGH for the rest of the period. A compare value equal to the period
+    // (EPC bit set) keeps the output LOW for the whole period.
+    if (duty >= period - 1) {
+        compare = 0;  // Always HIGH
+    } else {
+        compare = period - duty;
+    }
+
+    ctrl = pwm_ebs();
+    if (compare == period) {
+        ctrl |= PCA_EPCH;
+    } else {
+        ctrl |= (uint8_t)((compare >> 8) & MASK_TWO_BITS_HIGH) << 4;  // XCCAPnH, 10-bit only
+    }
+
+    if (pwm_get_mode(channel) != (PCA_ECOM | PCA_PWM)) {
+        // First use: load active and reload values before enabling the output
+        ctrl |= ((ctrl & PCA_XCCAPH_MASK) >> 2) | ((ctrl & PCA_EPCH) >> 1);
+        pwm_write(channel, ctrl, (uint8_t)compare, true);
+        pinMode(pin, OUTPUT);
+        pca_start();
+        return;
+    }
+
+    // Keep the active (L) fields, only the reload (H) fields change
+    old_ctrl = pwm_get_ctrl(channel);
+    ctrl |= old_ctrl & (PCA_XCCAPL_MASK | PCA_EPCL);
+
+    if (ctrl == old_ctrl) {
+        // Single register write, atomic with respect to the reload
+        pwm_write(channel, ctrl, (uint8_t)compare, false);
+        return;
+    }
+
+    ea_backup = IE & 0x80;
+    CLEAR_BIT(IE, 7);  // EA = 0 so both writes land in the same period
+    pwm_wait_first_half();
+    pwm_write(channel, ctrl, (uint8_t)compare, false);
+    if (ea_backup) SET_BIT(IE, 7);
+}
+
+void analogWriteStop(uint8_t pin) {
+    uint8_t channel = pca_pin_to_channel(pin);
+
+    digitalWrite(pin, LOW);
+
+    switch (channel) {
+        case 0:
+            CCAPM0 = 0x00;
+            PCA_PWM0 = 0x00;
+            break;
+
+        case 1:
+            CCAPM1 = 0x00;
+            PCA_PWM1 = 0x00;
+            break;
+
+        case 2:
+            CCAPM2 = 0x00;
+            PCA_PWM2 = 0x00;
+            break;
+    }
+}
+
+void analogWriteResolution(uint8_t bits) {
+    if (bits == PWM_RESOLUTION_6BIT || bits == PWM_RESOLUTION_7BIT ||
+        bits == PWM_RESOLUTION_8BIT || bits == PWM_RESOLUTION_10BIT) {
+        pwm_bits = bits;
+    }
+}
+
+bool analogWriteClock(PcaClock_t clock) {
+    if (pca_clock_owner() != PCA_CLOCK_OWNER_FREE) {
+        return false;
+    }
+    pca_set_clock(clock);
+    return true;
+}
+
+uint32_t analogWriteFrequency(void) {
+    return pca_clock_hz() >> pwm_bits;
+}
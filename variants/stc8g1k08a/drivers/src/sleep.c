@@ -0,0 +1,81 @@
+#include "Arduino.h"
+
+// Enter power-down; returns after the wake-up source fires
+static void sleep_enter(void) {
+    wakeup_irq = 0;
+    PCON |= PCON_PD;
+    HW_WAIT(PCON);  // Runs the wake-up timer on the host
+    NOP();  // Executed after wake-up, before the interrupt is serviced
+    NOP();
+}
+
+// Remainder of the last counts-to-microseconds conversion, carried so
+// repeated short sleeps do not lose time to rounding
+static MEM_COLD uint32_t sleep_us_fraction = 0;
+
+// Wake-up timer counts (16 clocks each) to microseconds, one decimal
+// step of 1000 at a time so nothing overflows 32 bits
+static uint32_t sleep_counts_to_us(uint16_t counts) {
+    uint32_t clocks = (uint32_t)counts * 16;
+    uint32_t part = (clocks % SLEEP_WKT_HZ) * 1000UL;
+    uint32_t us = (clocks / SLEEP_WKT_HZ) * 1000000UL + (part / SLEEP_WKT_HZ) * 1000UL;
+
+    part = (part % SLEEP_WKT_HZ) * 1000UL + sleep_us_fraction;
+    sleep_us_fraction = part % SLEEP_WKT_HZ;
+    return us + part / SLEEP_WKT_HZ;
+}
+
+// Sleep for up to SLEEP_WKT_MAX_COUNTS wake-up timer counts.
+// Returns the counts that elapsed.
+static uint16_t sleep_wkt(uint16_t counts) {
+    uint16_t reload = counts - 1;  // Wakes after reload + 1 counts
+    uint16_t elapsed;
+
+    WKTCL = LOW_BYTE(reload);
+    WKTCH = HIGH_BYTE(reload) | WKTCH_WKTEN;
+    sleep_enter();
+
+    // The count registers read back the internal counter, which stops
+    // short of the reload value if another source woke the chip
+    elapsed = ((uint16_t)(WKTCH & WKTCH_MASK) << 8) | WKTCL;
+    WKTCH = 0x00;  // Disable the wake-up timer
+
+    if (!wakeup_irq && elapsed >= reload) {
+        return counts;
+    }
+    if (elapsed >= counts) {
+        elapsed = counts;
+    }
+    return elapsed;
+}
+
+uint32_t sleepFor(uint32_t ms) {
+    uint32_t slept = 0;
+    uint16_t part;
+    uint16_t counts;
+    uint16_t elapsed;
+
+    millis();  // Make sure the tick is running so it can be credited
+
+    while (ms) {
+        part = (uint16_t)(ms > SLEEP_WKT_CHUNK_MS ? SLEEP_WKT_CHUNK_MS : ms);
+
+        // Rounded up, so a sleep ended by the timer is never short
+        counts = (uint16_t)(((uint32_t)part * SLEEP_WKT_HZ + 15999UL) / 16000UL);
+        elapsed = sleep_wkt(counts);
+        millis_credit_us(sleep_counts_to_us(elapsed));
+
+        if (elapsed < counts) {
+            // Woken early by an interrupt or UART RX
+            return slept + ((uint32_t)elapsed * 16000UL) / SLEEP_WKT_HZ;
+        }
+        slept += part;
+        ms -= part;
+    }
+
+    return slept;
+}
+
+void powerDown(void) {
+    sleep_enter();
+}
@@ -0,0 +1,6 @@
+#include "soft_serial_private.h"
+
+uint8_t softSerialAvailable(void)
+{
+    return (soft_rx_head - soft_rx_tail) & (SOFT_SERIAL_RX_BUFFER_SIZE - 1);
+}
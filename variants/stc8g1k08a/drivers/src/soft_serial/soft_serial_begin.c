@@ -0,0 +1,31 @@
+#include "soft_serial_private.h"
+
+bool softSerialBegin(uint8_t rx_pin, uint8_t tx_pin, uint32_t baud)
+{
+    uint8_t rx_int = digitalPinToInterrupt(rx_pin);
+
+    // The start bit needs an edge interrupt; the tick needs CPU time
+    if (rx_int > INT4_INTERRUPT || baud == 0 ||
+        getSystemClock() / (3UL * baud) < SOFT_SERIAL_MIN_TICK_CLOCKS) {
+        return false;
+    }
+
+    softSerialEnd();
+    if (!timerClaim(TIMER_SPARE, TIMER_OWNER_SOFT_SERIAL)) {
+        return false;
+    }
+
+    soft_serial_setup(rx_pin, tx_pin);
+    digitalWrite(tx_pin, HIGH);  // Idle level before the pin starts driving
+    pinMode(tx_pin, OUTPUT);
+    pinMode(rx_pin, INPUT_PULLUP);
+
+    if (!timerStartPeriodic(TIMER_SPARE, 3UL * baud, soft_serial_tick)) {
+        timerRelease(TIMER_SPARE, TIMER_OWNER_SOFT_SERIAL);
+        return false;
+    }
+
+    attachInterrupt(rx_int, soft_serial_start_bit, FALLING);
+    soft_running = true;
+    return true;
+}
@@ -0,0 +1,12 @@
+#include "soft_serial_private.h"
+
+void softSerialEnd(void)
+{
+    if (!soft_running) {
+        return;
+    }
+
+    detachInterrupt(soft_rx_int);
+    timerRelease(TIMER_SPARE, TIMER_OWNER_SOFT_SERIAL);  // Stops the tick
+    soft_running = false;
+}
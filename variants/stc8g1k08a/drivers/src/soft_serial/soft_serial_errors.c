@@ -0,0 +1,6 @@
+#include "soft_serial_private.h"
+
+uint8_t softSerialErrors(void)
+{
+    return soft_errors;
+}
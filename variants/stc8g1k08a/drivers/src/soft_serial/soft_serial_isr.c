@@ -0,0 +1,139 @@
+#include "soft_serial_private.h"
+
+// Placement follows the memory profile (memory.h)
+volatile MEM_RING uint8_t soft_rx_buffer[SOFT_SERIAL_RX_BUFFER_SIZE];
+volatile MEM_HOT uint8_t soft_rx_head = 0;
+volatile MEM_HOT uint8_t soft_rx_tail = 0;
+volatile MEM_WARM uint8_t soft_errors = 0;
+
+volatile MEM_RING uint8_t soft_tx_buffer[SOFT_SERIAL_TX_BUFFER_SIZE];
+volatile MEM_HOT uint8_t soft_tx_head = 0;
+volatile MEM_HOT uint8_t soft_tx_tail = 0;
+
+MEM_WARM bool soft_running = false;
+MEM_WARM uint8_t soft_rx_int = 0;
+
+// Pins as a port mask; port 3 unless the *_p5 flag is set
+static MEM_HOT uint8_t soft_rx_mask = 0;
+static MEM_HOT bool soft_rx_p5 = false;
+static MEM_HOT uint8_t soft_tx_mask = 0;
+static MEM_HOT bool soft_tx_p5 = false;
+
+// Bit engine, advanced once per tick (a third of a bit)
+static volatile MEM_HOT uint8_t soft_tx_phase = 3;  // Ticks left in the current TX bit
+static volatile MEM_HOT uint8_t soft_tx_bits = 0;   // Data and stop bits left, 0 = idle
+static volatile MEM_HOT uint16_t soft_tx_shift = 0;
+static volatile MEM_HOT uint8_t soft_rx_ticks = 0;  // Ticks to the next RX sample
+static volatile MEM_HOT uint8_t soft_rx_bits = 0;   // Samples left, 0 = waiting for a start bit
+static volatile MEM_HOT uint8_t soft_rx_shift = 0;
+
+void soft_serial_setup(uint8_t rx_pin, uint8_t tx_pin)
+{
+    soft_rx_mask = GET_MASK(rx_pin);
+    soft_rx_p5 = (GET_PORT(rx_pin) == PORT5);
+    soft_rx_int = digitalPinToInterrupt(rx_pin);
+    soft_tx_mask = GET_MASK(tx_pin);
+    soft_tx_p5 = (GET_PORT(tx_pin) == PORT5);
+
+    soft_tx_phase = 3;
+    soft_tx_bits = 0;
+    soft_rx_bits = 0;
+    soft_rx_head = 0;
+    soft_rx_tail = 0;
+    soft_tx_head = 0;
+    soft_tx_tail = 0;
+    soft_errors = 0;
+}
+
+void soft_serial_edge(bool enable)
+{
+    switch (soft_rx_int) {
+        case INT0_INTERRUPT:
+            CLEAR_BIT(TCON, 1);  // Clear IE0 latched during the byte
+            WRITE_BIT(IE, 0, enable);  // EX0
+            break;
+        case INT1_INTERRUPT:
+            CLEAR_BIT(TCON, 3);  // Clear IE1
+            WRITE_BIT(IE, 2, enable);  // EX1
+            break;
+        case INT2_INTERRUPT:
+            AUXINTIF &= ~AUXINTIF_INT2IF;
+            WRITE_BIT(INTCLKO, 4, enable);  // EX2
+            break;
+        case INT3_INTERRUPT:
+            AUXINTIF &= ~AUXINTIF_INT3IF;
+            WRITE_BIT(INTCLKO, 5, enable);  // EX3
+            break;
+        case INT4_INTERRUPT:
+            AUXINTIF &= ~AUXINTIF_INT4IF;
+            WRITE_BIT(INTCLKO, 6, enable);  // EX4
+            break;
+    }
+}
+
+static void soft_tx_level(uint8_t high)
+{
+    if (soft_tx_p5) {
+        if (high) P5 |= soft_tx_mask; else P5 &= ~soft_tx_mask;
+    } else {
+        if (high) P3 |= soft_tx_mask; else P3 &= ~soft_tx_mask;
+    }
+}
+
+// The edge lands somewhere inside a tick, so the next ticks come 0..1,
+// 1..2, ... ticks after it. The fifth one falls 1.33..1.67 bits after
+// the edge: the middle of data bit 0.
+void soft_serial_start_bit(void)
+{
+    soft_serial_edge(false);  // Data bits would trigger it again
+    soft_rx_ticks = 5;
+    soft_rx_bits = 9;         // 8 data bits and the stop bit
+}
+
+void soft_serial_tick(void)
+{
+    uint8_t level;
+
+    // RX: check the start bit on the second tick, then sample every third
+    if (soft_rx_bits) {
+        level = (soft_rx_p5 ? P5 : P3) & soft_rx_mask;
+        if (--soft_rx_ticks == 3) {
+            if (level) {
+                soft_rx_bits = 0;  // Glitch, not a start bit
+                soft_serial_edge(true);
+            }
+        } else if (soft_rx_ticks == 0) {
+            soft_rx_ticks = 3;
+            if (--soft_rx_bits) {
+                soft_rx_shift >>= 1;
+                if (level) soft_rx_shift |= 0x80;
+            } else {
+                uint8_t next = (soft_rx_head + 1) & (SOFT_SERIAL_RX_BUFFER_SIZE - 1);
+
+                if (level && next != soft_rx_tail) {
+                    soft_rx_buffer[soft_rx_head] = soft_rx_shift;
+                    soft_rx_head = next;
+                } else {
+                    soft_errors++;  // Framing error or overrun
+                }
+                soft_serial_edge(true);
+            }
+        }
+    }
+
+    // TX: next bit every third tick, next byte straight after the stop bit
+    if (--soft_tx_phase) {
+        return;
+    }
+    soft_tx_phase = 3;
+    if (soft_tx_bits) {
+        soft_tx_level((uint8_t)soft_tx_shift & 1);
+        soft_tx_shift >>= 1;
+        soft_tx_bits--;
+    } else if (soft_tx_head != soft_tx_tail) {
+        soft_tx_shift = soft_tx_buffer[soft_tx_tail] | 0x100;  // Stop bit on top
+        soft_tx_tail = (soft_tx_tail + 1) & (SOFT_SERIAL_TX_BUFFER_SIZE - 1);
+        soft_tx_bits = 9;
+        soft_tx_level(0);  // Start bit
+    }
+}
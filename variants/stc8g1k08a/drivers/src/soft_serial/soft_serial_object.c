@@ -0,0 +1,15 @@
+#include "soft_serial_private.h"
+
+// SoftSerial object instance. The initializer references every method,
+// so a sketch using SoftSerial links all of them; calling the
+// softSerial*() functions directly links only the ones used.
+SoftSerial_t SoftSerial = {
+    .begin = softSerialBegin,
+    .end = softSerialEnd,
+    .available = softSerialAvailable,
+    .read = softSerialRead,
+    .write = softSerialWrite,
+    .print = softSerialPrint,
+    .println = softSerialPrintln,
+    .printNumber = softSerialPrintNumber,
+};
@@ -0,0 +1,8 @@
+#include "soft_serial_private.h"
+
+void softSerialPrint(const char *str)
+{
+    while (*str) {
+        softSerialWrite(*str++);
+    }
+}
@@ -0,0 +1,19 @@
+#include "soft_serial_private.h"
+
+void softSerialPrintNumber(int32_t num) __reentrant
+{
+    char buffer[12];  // -2147483648 is 11 chars + null
+    char *ptr = buffer + sizeof(buffer) - 1;
+    uint32_t abs_num = (num < 0) ? (uint32_t)0 - (uint32_t)num : (uint32_t)num;
+
+    *ptr = '\0';
+    do {
+        *(--ptr) = '0' + (abs_num % 10);
+        abs_num /= 10;
+    } while (abs_num);
+
+    if (num < 0) {
+        *(--ptr) = '-';
+    }
+    softSerialPrint(ptr);
+}
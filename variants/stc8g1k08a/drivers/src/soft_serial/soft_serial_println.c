@@ -0,0 +1,8 @@
+#include "soft_serial_private.h"
+
+void softSerialPrintln(const char *str)
+{
+    softSerialPrint(str);
+    softSerialWrite('\r');
+    softSerialWrite('\n');
+}
@@ -0,0 +1,45 @@
+#ifndef SOFT_SERIAL_PRIVATE_H
+#define SOFT_SERIAL_PRIVATE_H
+
+#include "Arduino.h"
+
+// Shared state of the software UART. The bit engine lives in
+// soft_serial_isr.c; each public function has its own file so the
+// linker only pulls in what a sketch calls.
+
+// Filled by soft_serial_tick(), drained by softSerialRead()
+extern volatile MEM_RING uint8_t soft_rx_buffer[SOFT_SERIAL_RX_BUFFER_SIZE];
+extern volatile MEM_HOT uint8_t soft_rx_head;
+extern volatile MEM_HOT uint8_t soft_rx_tail;
+extern volatile MEM_WARM uint8_t soft_errors;
+
+// Filled by softSerialWrite(), drained by soft_serial_tick()
+extern volatile MEM_RING uint8_t soft_tx_buffer[SOFT_SERIAL_TX_BUFFER_SIZE];
+extern volatile MEM_HOT uint8_t soft_tx_head;
+extern volatile MEM_HOT uint8_t soft_tx_tail;
+
+// Set by softSerialBegin()
+extern MEM_WARM bool soft_running;
+extern MEM_WARM uint8_t soft_rx_int;  // INTx number of the RX pin
+
+/**
+ * @brief Reset the bit engine and select the pins
+ */
+void soft_serial_setup(uint8_t rx_pin, uint8_t tx_pin);
+
+/**
+ * @brief Mask or unmask the start-bit interrupt of the RX pin
+ */
+void soft_serial_edge(bool enable);
+
+/**
+ * @brief TIMER_SPARE callback at 3x the baud rate
+ */
+void soft_serial_tick(void);
+
+/**
+ * @brief INTx callback on the falling edge of a start bit
+ */
+void soft_serial_start_bit(void);
+
+#endif // SOFT_SERIAL_PRIVATE_H
@@ -0,0 +1,14 @@
+#include "soft_serial_private.h"
+
+int softSerialRead(void)
+{
+    int data;
+
+    if (soft_rx_head == soft_rx_tail) {
+        return -1;
+    }
+
+    data = soft_rx_buffer[soft_rx_tail];
+    soft_rx_tail = (soft_rx_tail + 1) & (SOFT_SERIAL_RX_BUFFER_SIZE - 1);
+    return data;
+}
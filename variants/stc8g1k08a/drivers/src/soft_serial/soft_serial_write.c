@@ -0,0 +1,17 @@
+#include "soft_serial_private.h"
+
+void softSerialWrite(uint8_t byte)
+{
+    uint8_t next = (soft_tx_head + 1) & (SOFT_SERIAL_TX_BUFFER_SIZE - 1);
+
+    if (!soft_running) {
+        return;  // Nothing would drain the buffer
+    }
+
+    // The tick ISR frees one slot per byte time
+    while (next == soft_tx_tail)
+        HW_WAIT(soft_tx_tail);
+
+    soft_tx_buffer[soft_tx_head] = byte;
+    soft_tx_head = next;
+}
@@ -0,0 +1,111 @@
+#include "Arduino.h"
+
+// Periodic mode state - moved to XRAM to save internal RAM
+static MEM_COLD uint32_t timer_rate_hz = 0;           // Periodic rate of TIMER_SPARE
+static MEM_HOT TimerHandler_t spare_handler = 0;
+
+extern MEM_HOT TimerHandler_t timer_spare_stop;  // timers.c
+
+// Periodic callback dispatch for the timer the tick does not use
+#if TICK_TIMER == 2
+void timer0_isr(void) __interrupt(1)
+#else
+void timer2_isr(void) __interrupt(12)
+#endif
+{
+    if (spare_handler) {
+        spare_handler();
+    }
+}
+
+// Program TIMER_SPARE as a 16-bit auto-reload timer; 12T for slow rates
+static bool timer_spare_program(uint32_t rate_hz) {
+    uint32_t clk = getSystemClock();
+    uint32_t counts;
+    bool use_12t = false;
+    uint16_t reload;
+
+    counts = clk / rate_hz;
+    if (counts > 65536UL) {
+        counts = clk / 12UL / rate_hz;
+        use_12t = true;
+    }
+    if (counts < 2 || counts > 65536UL) {
+        return false;
+    }
+    reload = (uint16_t)(65536UL - counts);
+
+#if TICK_TIMER == 2
+    // Timer0 mode 0: 16-bit auto-reload, writes with TR0 = 0 load the reload value
+    CLEAR_BIT(TCON, TR0_BIT);
+    CLEAR_BIT_MASK(TMOD, 0x0F);
+    if (use_12t) {
+        CLEAR_BIT(AUXR, T0x12_BIT);
+    } else {
+        SET_BIT(AUXR, T0x12_BIT);
+    }
+    TH0 = HIGH_BYTE(reload);
+    TL0 = LOW_BYTE(reload);
+    CLEAR_BIT(TCON, TF0_BIT);
+    SET_BIT(IE, 1);  // ET0 = 1
+    SET_BIT(TCON, TR0_BIT);
+#else
+    // Timer2: always 16-bit auto-reload, writes with T2R = 0 load the reload value
+    AUXR &= ~(AUXR_T2R | AUXR_T2_CT);
+    if (use_12t) {
+        AUXR &= ~AUXR_T2x12;
+    } else {
+        AUXR |= AUXR_T2x12;
+    }
+    T2H = HIGH_BYTE(reload);
+    T2L = LOW_BYTE(reload);
+    AUXINTIF &= ~AUXINTIF_T2IF;
+    IE2 |= IE2_ET2;
+    AUXR |= AUXR_T2R;
+#endif
+    SET_BIT(IE, 7);  // EA = 1
+    return true;
+}
+
+static void timer_spare_stop_hook(void) {
+    timerStop(TIMER_SPARE);
+}
+
+// Keep the periodic rate after a system clock change
+static void timer_clock_changed(void) {
+    if (timer_rate_hz && !timer_spare_program(timer_rate_hz)) {
+        timerStop(TIMER_SPARE);  // Rate no longer reachable
+    }
+}
+
+bool timerStartPeriodic(uint8_t timer, uint32_t rate_hz, TimerHandler_t handler) {
+    if (timer != TIMER_SPARE || timerOwner(timer) == TIMER_OWNER_FREE || rate_hz == 0) {
+        return false;
+    }
+
+    timerStop(timer);
+    spare_handler = handler;
+    if (!timer_spare_program(rate_hz)) {
+        spare_handler = 0;
+        return false;
+    }
+    timer_rate_hz = rate_hz;
+    timer_spare_stop = timer_spare_stop_hook;
+    clockAddListener(timer_clock_changed);
+    return true;
+}
+
+void timerStop(uint8_t timer) {
+    if (timer != TIMER_SPARE) {
+        return;
+    }
+
+#if TICK_TIMER == 2
+    CLEAR_BIT(TCON, TR0_BIT);
+    CLEAR_BIT(IE, 1);  // ET0 = 0
+#else
+    AUXR &= ~AUXR_T2R;
+    IE2 &= ~IE2_ET2;
+#endif
+    timer_rate_hz = 0;
+}
@@ -0,0 +1,42 @@
+#include "Arduino.h"
+
+// Timer ownership - moved to XRAM to save internal RAM. Also freed by
+// the tick interrupt when a timed tone() ends (clock_out_private.h).
+volatile MEM_COLD uint8_t timer_owner[TIMER_COUNT];
+static MEM_COLD uint8_t timer_conflicts = 0;
+
+// Stops TIMER_SPARE; set by timerStartPeriodic() so the allocator alone
+// does not link the periodic timer code and its ISR
+MEM_HOT TimerHandler_t timer_spare_stop = 0;
+
+bool timerClaim(uint8_t timer, uint8_t owner) {
+    if (timer >= TIMER_COUNT) {
+        return false;
+    }
+    if (timer_owner[timer] != TIMER_OWNER_FREE && timer_owner[timer] != owner) {
+        timer_conflicts++;
+        return false;
+    }
+    timer_owner[timer] = owner;
+    return true;
+}
+
+void timerRelease(uint8_t timer, uint8_t owner) {
+    if (timer < TIMER_COUNT && timer_owner[timer] == owner) {
+        if (timer == TIMER_SPARE && timer_spare_stop) {
+            timer_spare_stop();
+        }
+        timer_owner[timer] = TIMER_OWNER_FREE;
+    }
+}
+
+uint8_t timerOwner(uint8_t timer) {
+    if (timer >= TIMER_COUNT) {
+        return TIMER_OWNER_FREE;
+    }
+    return timer_owner[timer];
+}
+
+uint8_t timerConflicts(void) {
+    return timer_conflicts;
+}
@@ -3,81 +3,134 @@
 
 #include <stdint.h>
 #include "drivers/inc/gpio.h"
+#include "drivers/inc/clock.h"
 #include "drivers/inc/timer.h"
 #include "drivers/inc/i2c.h"
+#include "drivers/inc/pca.h"
+#include "drivers/inc/adc.h"
+#include "drivers/inc/iap.h"
+#include "drivers/inc/eeprom.h"
+#include "drivers/inc/sleep.h"
+#include "drivers/inc/soft_serial.h"
+#include "drivers/inc/onewire.h"
+#include "drivers/inc/clock_out.h"
+#include "drivers/inc/debounce.h"
 
 // STC8G1K08A Register Definitions
-__sfr __at(0x80) P0;
-__sfr __at(0x81) SP;
-__sfr __at(0x82) DPL;
-__sfr __at(0x83) DPH;
-__sfr __at(0x87) PCON;
-__sfr __at(0x88) TCON;
-__sfr __at(0x89) TMOD;
-__sfr __at(0x8A) TL0;
-__sfr __at(0x8B) TL1;
-__sfr __at(0x8C) TH0;
-__sfr __at(0x8D) TH1;
-__sfr __at(0x8E) AUXR;
-__sfr __at(0x8F) INTCLKO; // External interrupt control
-__sfr __at(0x90) P1;
-__sfr __at(0x91) P1M1;
-__sfr __at(0x92) P1M0;
-__sfr __at(0x93) P0M1;
-__sfr __at(0x94) P0M0;
-__sfr __at(0x98) SCON;    // UART1 control register
-__sfr __at(0x99) SBUF;    // UART1 data buffer register
-__sfr __at(0x9D) IRCBAND; // IRC band selection register
-__sfr __at(0x9E) LIRTRIM; // IRC frequency trim register
-__sfr __at(0x9F) IRTRIM;  // IRC frequency adjustment register
-__sfr __at(0xA0) P2;
-__sfr __at(0xA2) P_SW1; // Peripheral port switch register 1
-__sfr __at(0xA8) IE;
-__sfr __at(0xA9) SADDR; // UART1 slave address register
-__sfr __at(0xB0) P3;
-__sfr __at(0xB1) P3M1;
-__sfr __at(0xB2) P3M0;
-__sfr __at(0xB8) IP;
-__sfr __at(0xB9) SADEN; // UART1 slave address enable register
-__sfr __at(0xBA) P_SW2; // Peripheral port switch register 2
-__sfr __at(0xC8) P5;
-__sfr __at(0xC9) P5M1;
-__sfr __at(0xCA) P5M0;
-__sfr __at(0xD0) PSW;
-__sfr __at(0xE0) ACC;
-__sfr __at(0xEF) AUXINTIF; // Auxiliary interrupt flags
-__sfr __at(0xF0) B;
+SFR(P0, 0x80);
+SFR(SP, 0x81);
+SFR(DPL, 0x82);
+SFR(DPH, 0x83);
+SFR(PCON, 0x87);
+SFR(TCON, 0x88);
+SFR(TMOD, 0x89);
+SFR(TL0, 0x8A);
+SFR(TL1, 0x8B);
+SFR(TH0, 0x8C);
+SFR(TH1, 0x8D);
+SFR(AUXR, 0x8E);
+SFR(INTCLKO, 0x8F);   // External interrupt control
+SFR(P1, 0x90);
+SFR(P1M1, 0x91);
+SFR(P1M0, 0x92);
+SFR(P0M1, 0x93);
+SFR(P0M0, 0x94);
+SFR(SCON, 0x98);      // UART1 control register
+SFR(SBUF, 0x99);      // UART1 data buffer register
+SFR(IRCBAND, 0x9D);   // IRC band selection register
+SFR(LIRTRIM, 0x9E);   // IRC frequency trim register
+SFR(IRTRIM, 0x9F);    // IRC frequency adjustment register
+SFR(P2, 0xA0);
+SFR(P_SW1, 0xA2);     // Peripheral port switch register 1
+SFR(IE, 0xA8);
+SFR(SADDR, 0xA9);     // UART1 slave address register
+SFR(WKTCL, 0xAA);     // Power-down wake-up timer low byte
+SFR(WKTCH, 0xAB);     // Power-down wake-up timer high byte
+SFR(IE2, 0xAF);       // Interrupt enable register 2
+SFR(P3, 0xB0);
+SFR(P3M1, 0xB1);
+SFR(P3M0, 0xB2);
+SFR(IP, 0xB8);
+SFR(SADEN, 0xB9);     // UART1 slave address enable register
+SFR(P_SW2, 0xBA);     // Peripheral port switch register 2
+SFR(ADC_CONTR, 0xBC); // ADC control register
+SFR(ADC_RES, 0xBD);   // ADC result high byte
+SFR(ADC_RESL, 0xBE);  // ADC result low byte
+SFR(IAP_DATA, 0xC2);  // IAP data register
+SFR(IAP_ADDRH, 0xC3); // IAP address high byte
+SFR(IAP_ADDRL, 0xC4); // IAP address low byte
+SFR(IAP_CMD, 0xC5);   // IAP command register
+SFR(IAP_TRIG, 0xC6);  // IAP trigger register
+SFR(IAP_CONTR, 0xC7); // IAP control register
+SFR(P5, 0xC8);
+SFR(P5M1, 0xC9);
+SFR(P5M0, 0xCA);
+SFR(PSW, 0xD0);
+SFR(T2H, 0xD6);       // Timer2 high byte
+SFR(T2L, 0xD7);       // Timer2 low byte
+SFR(CCON, 0xD8);      // PCA control register
+SFR(CMOD, 0xD9);      // PCA mode register
+SFR(CCAPM0, 0xDA);    // PCA module 0 mode register
+SFR(CCAPM1, 0xDB);    // PCA module 1 mode register
+SFR(CCAPM2, 0xDC);    // PCA module 2 mode register
+SFR(ADCCFG, 0xDE);    // ADC configuration register
+SFR(ACC, 0xE0);
+SFR(CL, 0xE9);        // PCA counter low byte
+SFR(CCAP0L, 0xEA);    // PCA module 0 compare/capture low byte
+SFR(CCAP1L, 0xEB);    // PCA module 1 compare/capture low byte
+SFR(CCAP2L, 0xEC);    // PCA module 2 compare/capture low byte
+SFR(AUXINTIF, 0xEF);  // Auxiliary interrupt flags
+SFR(B, 0xF0);
+SFR(PCA_PWM0, 0xF2);  // PCA module 0 PWM mode register
+SFR(PCA_PWM1, 0xF3);  // PCA module 1 PWM mode register
+SFR(PCA_PWM2, 0xF4);  // PCA module 2 PWM mode register
+SFR(IAP_TPS, 0xF5);   // IAP wait time (SYSclk in MHz)
+SFR(CH, 0xF9);        // PCA counter high byte
+SFR(CCAP0H, 0xFA);    // PCA module 0 compare/capture high byte (PWM reload)
+SFR(CCAP1H, 0xFB);    // PCA module 1 compare/capture high byte (PWM reload)
+SFR(CCAP2H, 0xFC);    // PCA module 2 compare/capture high byte (PWM reload)
 
 // Extended SFRs (XDATA area) - Clock & Power
-__xdata __at(0xFE00) volatile uint8_t CKSEL;
-__xdata __at(0xFE01) volatile uint8_t CLKDIV;
-__xdata __at(0xFE02) volatile uint8_t HIRCCR;
-__xdata __at(0xFE03) volatile uint8_t XOSCCR;
-__xdata __at(0xFE04) volatile uint8_t IRC32KCR;
-__xdata __at(0xFE05) volatile uint8_t MCLKOCR;
+XFR(CKSEL, 0xFE00);
+XFR(CLKDIV, 0xFE01);
+XFR(HIRCCR, 0xFE02);
+XFR(XOSCCR, 0xFE03);
+XFR(IRC32KCR, 0xFE04);
+XFR(MCLKOCR, 0xFE05);
 
 // Extended SFRs - GPIO Pull-up and Input Enable
-__xdata __at(0xFE10) volatile uint8_t P0PU;
-__xdata __at(0xFE11) volatile uint8_t P1PU;
-__xdata __at(0xFE12) volatile uint8_t P2PU;
-__xdata __at(0xFE13) volatile uint8_t P3PU;
-__xdata __at(0xFE15) volatile uint8_t P5PU;
-__xdata __at(0xFE30) volatile uint8_t P0IE;
-__xdata __at(0xFE31) volatile uint8_t P1IE;
-__xdata __at(0xFE32) volatile uint8_t P2IE;
-__xdata __at(0xFE33) volatile uint8_t P3IE;
-__xdata __at(0xFE35) volatile uint8_t P5IE;
+XFR(P0PU, 0xFE10);
+XFR(P1PU, 0xFE11);
+XFR(P2PU, 0xFE12);
+XFR(P3PU, 0xFE13);
+XFR(P5PU, 0xFE15);
+XFR(P0IE, 0xFE30);
+XFR(P1IE, 0xFE31);
+XFR(P2IE, 0xFE32);
+XFR(P3IE, 0xFE33);
+XFR(P5IE, 0xFE35);
+
+// Extended SFRs - ADC Timing
+XFR(ADCTIM, 0xFEA8); // ADC timing control register
 
 // Extended SFRs - I2C Registers
-__xdata __at(0xFE80) volatile uint8_t I2CCFG;   // I2C Configuration Register
-__xdata __at(0xFE81) volatile uint8_t I2CMSCR;  // I2C Master Control Register
-__xdata __at(0xFE82) volatile uint8_t I2CMSST;  // I2C Master Status Register
-__xdata __at(0xFE83) volatile uint8_t I2CSLCR;  // I2C Slave Control Register
-__xdata __at(0xFE84) volatile uint8_t I2CSLST;  // I2C Slave Status Register
-__xdata __at(0xFE85) volatile uint8_t I2CSLADR; // I2C Slave Address Register
-__xdata __at(0xFE86) volatile uint8_t I2CTXD;   // I2C Data Transmission Register
-__xdata __at(0xFE87) volatile uint8_t I2CRXD;   // I2C Data Receive Register
-__xdata __at(0xFE88) volatile uint8_t I2CMSAUX; // I2C Master Auxiliary Control Register
+XFR(I2CCFG, 0xFE80);   // I2C Configuration Register
+XFR(I2CMSCR, 0xFE81);  // I2C Master Control Register
+XFR(I2CMSST, 0xFE82);  // I2C Master Status Register
+XFR(I2CSLCR, 0xFE83);  // I2C Slave Control Register
+XFR(I2CSLST, 0xFE84);  // I2C Slave Status Register
+XFR(I2CSLADR, 0xFE85); // I2C Slave Address Register
+XFR(I2CTXD, 0xFE86);   // I2C Data Transmission Register
+XFR(I2CRXD, 0xFE87);   // I2C Data Receive Register
+XFR(I2CMSAUX, 0xFE88); // I2C Master Auxiliary Control Register
+
+// PCON Register Bits
+#define PCON_PD 0x02  // Power-down mode (cleared on wake-up)
+#define PCON_IDL 0x01 // Idle mode
+
+// WKTCH Register Bits
+#define WKTCH_WKTEN 0x80 // Wake-up timer enable
+#define WKTCH_MASK 0x7F  // Count bits 14:8
 
 // P_SW2 bits
 #define EAXFR 0x80 // Extended RAM/SFR access enable
@@ -112,6 +165,92 @@ __xdata __at(0xFE88) volatile uint8_t I2CMSAUX; // I2C Master Auxiliary Control
 
 #define MASK_TWO_BITS_HIGH 0x03
 
+// AUXR Register - Timer2 Bits
+#define AUXR_T2R 0x10   // Timer2 run control
+#define AUXR_T2_CT 0x08 // Timer2 counter mode (count T2 pin)
+#define AUXR_T2x12 0x04 // Timer2 1T mode (SYSclk/1 instead of SYSclk/12)
+
+// IE2 Register Bits
+#define IE2_ET2 0x04 // Timer2 interrupt enable
+
+// AUXINTIF Register Bits
+#define AUXINTIF_T2IF 0x01 // Timer2 interrupt flag
+#define AUXINTIF_INT2IF 0x10 // INT2 interrupt flag
+#define AUXINTIF_INT3IF 0x20 // INT3 interrupt flag
+#define AUXINTIF_INT4IF 0x40 // INT4 interrupt flag
+
+// ADC_CONTR Register Bits
+#define ADC_POWER 0x80 // ADC power on
+#define ADC_START 0x40 // Start conversion (cleared by hardware)
+#define ADC_FLAG 0x20  // Conversion complete flag
+#define ADC_CHS_MASK 0x0F // Channel select
+
+// ADCCFG Register Bits
+#define ADC_RESFMT 0x20 // Right-justified result (ADC_RES holds bits 9:8)
+#define ADC_SPEED_MASK 0x0F // ADC clock = SYSclk / 2 / (SPEED + 1)
+
+// ADC channels on STC8G1K08A-8PIN (channel number = Arduino pin number)
+#define ADC_CHANNEL_VREF 15 // Internal 1.19V bandgap reference
+
+// IAP_CMD Register - Commands
+#define IAP_CMD_IDLE 0x00  // No operation
+#define IAP_CMD_READ 0x01  // Read one byte
+#define IAP_CMD_WRITE 0x02 // Program one byte (bits can only go 1 -> 0)
+#define IAP_CMD_ERASE 0x03 // Erase a 512-byte sector to 0xFF
+
+// IAP_TRIG Register - Trigger sequence
+#define IAP_TRIG_KEY1 0x5A
+#define IAP_TRIG_KEY2 0xA5
+
+// IAP_CONTR Register Bits
+#define IAP_IAPEN 0x80    // IAP enable
+#define IAP_CMD_FAIL 0x10 // Command failed (address out of range)
+
+// MCLKOCR Register - Master clock output
+#define MCLKO_S 0x80      // Output on P1.6 instead of P5.4 (not bonded on the 8-pin part)
+#define MCLKODIV_MASK 0x7F // SYSclk divider, 0 = output off
+
+// CCP/PCA pin selection for STC8G1K08A (bits 5:4 of P_SW1)
+#define CCP_S_P32_P33_P54 0x00 // CCP0=P3.2, CCP1=P3.3, CCP2=P5.4, ECI=P5.5 (default)
+
+// CCON Register Bits
+#define PCA_CF 0x80   // PCA counter overflow flag
+#define PCA_CR 0x40   // PCA counter run control
+#define PCA_CCF2 0x04 // Module 2 match/capture flag
+#define PCA_CCF1 0x02 // Module 1 match/capture flag
+#define PCA_CCF0 0x01 // Module 0 match/capture flag
+
+// CMOD Register - Counter Clock Source (CPS bits 3:1)
+#define CMOD_CPS_MASK 0x0E
+#define CMOD_CPS_SYSCLK_DIV12 0x00 // SYSclk/12
+#define CMOD_CPS_SYSCLK_DIV2 0x02  // SYSclk/2
+#define CMOD_CPS_TIMER0 0x04       // Timer0 overflow
+#define CMOD_CPS_ECI 0x06          // External clock on ECI pin
+#define CMOD_CPS_SYSCLK 0x08       // SYSclk
+#define CMOD_CPS_SYSCLK_DIV4 0x0A  // SYSclk/4
+#define CMOD_CPS_SYSCLK_DIV6 0x0C  // SYSclk/6
+#define CMOD_CPS_SYSCLK_DIV8 0x0E  // SYSclk/8
+#define CMOD_ECF 0x01              // Counter overflow interrupt enable
+
+// CCAPMn Register Bits
+#define PCA_ECOM 0x40 // Comparator enable
+#define PCA_CCAPP 0x20 // Capture on rising edge
+#define PCA_CCAPN 0x10 // Capture on falling edge
+#define PCA_MAT 0x08  // Match flag enable
+#define PCA_TOG 0x04  // Toggle output on match
+#define PCA_PWM 0x02  // PWM output enable
+#define PCA_ECCF 0x01 // Module interrupt enable
+
+// PCA_PWMn Register Bits
+#define PCA_EBS_8BIT 0x00  // 8-bit PWM
+#define PCA_EBS_7BIT 0x40  // 7-bit PWM
+#define PCA_EBS_6BIT 0x80  // 6-bit PWM
+#define PCA_EBS_10BIT 0xC0 // 10-bit PWM
+#define PCA_XCCAPH_MASK 0x30 // Compare bits 9:8, reload value
+#define PCA_XCCAPL_MASK 0x0C // Compare bits 9:8, active value
+#define PCA_EPCH 0x02 // Compare bit 10 (EPC), reload value
+#define PCA_EPCL 0x01 // Compare bit 10 (EPC), active value
+
 // UART Mode definitions
 #define UART_MODE_1 0x01 // 8-bit UART, variable baud rate
 
@@ -133,8 +272,11 @@ __xdata __at(0xFE88) volatile uint8_t I2CMSAUX; // I2C Master Auxiliary Control
 #define TIMER0_ISR_VECTOR 1
 #define INT1_ISR_VECTOR 2
 #define UART1_ISR_VECTOR 4
+#define ADC_ISR_VECTOR 5
+#define PCA_ISR_VECTOR 7
 #define INT2_ISR_VECTOR 10
 #define INT3_ISR_VECTOR 11
+#define TIMER2_ISR_VECTOR 12
 #define INT4_ISR_VECTOR 16
 #define I2C_ISR_VECTOR 24 // I2C interrupt vector
 